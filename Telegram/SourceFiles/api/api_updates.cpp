@@ -85,6 +85,9 @@ constexpr auto kNoUpdatesTimeout = 60 * 1000;
 // If nothing is received in 1 min when was a sleepmode we ping.
 constexpr auto kNoUpdatesAfterSleepTimeout = 60 * crl::time(1000);
 
+// Updates that take longer than that on the main thread are logged.
+constexpr auto kSlowUpdateDuration = crl::time(20);
+
 enum class DataIsLoadedResult {
 	NotLoaded = 0,
 	FromNotLoaded = 1,
@@ -340,7 +343,18 @@ void Updates::feedUpdateVector(
 				&& type != mtpc_updateGroupCallChainBlocks)) {
 			continue;
 		}
+		const auto started = Logs::DebugEnabled()
+			? crl::now()
+			: crl::time();
 		feedUpdate(entry);
+		if (started) {
+			const auto duration = crl::now() - started;
+			if (duration >= kSlowUpdateDuration) {
+				DEBUG_LOG(("Updates: update 0x%1 took %2 ms."
+					).arg(type, 0, 16
+					).arg(duration));
+			}
+		}
 	}
 	session().data().sendHistoryChangeNotifications();
 }
@@ -619,6 +633,7 @@ void Updates::feedDifference(
 		const MTPVector<MTPChat> &chats,
 		const MTPVector<MTPMessage> &msgs,
 		const MTPVector<MTPUpdate> &other) {
+	const auto started = crl::now();
 	Core::App().checkAutoLock();
 	session().data().processUsers(users);
 	session().data().processChats(chats);
@@ -626,6 +641,13 @@ void Updates::feedDifference(
 	feedMessageIds(other);
 	session().data().processMessages(msgs, NewMessageType::Unread);
 	feedUpdateVector(other, SkipUpdatePolicy::SkipMessageIds);
+	DEBUG_LOG(("Updates: difference with %1 users, %2 chats, "
+		"%3 messages, %4 updates applied in %5 ms."
+		).arg(users.v.size()
+		).arg(chats.v.size()
+		).arg(msgs.v.size()
+		).arg(other.v.size()
+		).arg(crl::now() - started));
 }
 
 void Updates::differenceFail(const MTP::Error &error) {
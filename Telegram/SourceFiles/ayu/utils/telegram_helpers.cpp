@@ -56,6 +56,33 @@ constexpr auto usernameResolverBotId = 7424190611L;
 const auto usernameResolverBotUsername = QString("tgdb_search_bot");
 const auto usernameResolverEmpty = QString("Error, username or id invalid/not found.");
 
+constexpr auto kReadRequestDelay = crl::time(5);
+
+// Peer, topic root and sublist peer of a thread being read.
+using ReadRequestKey = std::tuple<PeerId, MsgId, PeerId>;
+
+// Bulk reads may ask for the same thread again while the previous
+// request is still in flight, those repeated requests are skipped.
+struct ReadingState {
+	base::flat_set<ReadRequestKey> mentions;
+	base::flat_set<ReadRequestKey> reactions;
+};
+
+// Requests of a destroyed session never finish, so its keys are dropped
+// together with the session instead of waiting for done or fail.
+base::flat_map<not_null<Main::Session*>, ReadingState> Reading;
+
+ReadingState &ReadingFor(not_null<Main::Session*> session) {
+	const auto i = Reading.find(session);
+	if (i != end(Reading)) {
+		return i->second;
+	}
+	session->lifetime().add([=] {
+		Reading.remove(session);
+	});
+	return Reading.emplace(session, ReadingState()).first->second;
+}
+
 }
 
 Main::Session *getSession(ID userId) {
@@ -206,6 +233,15 @@ void MarkAsReadChatList(not_null<Dialogs::MainList*> list) {
 			mark.push_back(history);
 		}
 	}
+	if (mark.empty()) {
+		return;
+	}
+
+	// Report the resulting unread state once for the whole list,
+	// instead of recounting badges after every read chat.
+	const auto main = mark.front()->owner().chatsList();
+	const auto holdMain = main->holdUnreadStateChanges();
+	const auto holdList = list->holdUnreadStateChanges();
 	ranges::for_each(mark, MarkAsReadThread);
 }
 
@@ -217,6 +253,10 @@ void readMentions(base::weak_ptr<Data::Thread> weakThread) {
 	const auto peer = thread->peer();
 	const auto topic = thread->asTopic();
 	const auto rootId = topic ? topic->rootId() : 0;
+	const auto key = ReadRequestKey(peer->id, rootId, PeerId());
+	if (!ReadingFor(&peer->session()).mentions.emplace(key).second) {
+		return;
+	}
 	using Flag = MTPmessages_ReadMentions::Flag;
 	peer->session().api().request(MTPmessages_ReadMentions(
 		MTP_flags(rootId ? Flag::f_top_msg_id : Flag()),
@@ -224,6 +264,7 @@ void readMentions(base::weak_ptr<Data::Thread> weakThread) {
 		MTP_int(rootId)
 	)).done([=](const MTPmessages_AffectedHistory &result)
 	{
+		ReadingFor(&peer->session()).mentions.remove(key);
 		const auto offset = peer->session().api().applyAffectedHistory(
 			peer,
 			result);
@@ -232,7 +273,10 @@ void readMentions(base::weak_ptr<Data::Thread> weakThread) {
 		} else {
 			peer->owner().history(peer)->clearUnreadMentionsFor(rootId);
 		}
-	}).send();
+	}).fail([=]
+	{
+		ReadingFor(&peer->session()).mentions.remove(key);
+	}).afterDelay(kReadRequestDelay).send();
 }
 
 void readReactions(base::weak_ptr<Data::Thread> weakThread) {
@@ -244,6 +288,13 @@ void readReactions(base::weak_ptr<Data::Thread> weakThread) {
 	const auto sublist = thread->asSublist();
 	const auto peer = thread->peer();
 	const auto rootId = topic ? topic->rootId() : 0;
+	const auto key = ReadRequestKey(
+		peer->id,
+		rootId,
+		sublist ? sublist->sublistPeer()->id : PeerId());
+	if (!ReadingFor(&peer->session()).reactions.emplace(key).second) {
+		return;
+	}
 	using Flag = MTPmessages_ReadReactions::Flag;
 	peer->session().api().request(MTPmessages_ReadReactions(
 		MTP_flags(rootId ? Flag::f_top_msg_id : Flag(0)),
@@ -252,6 +303,7 @@ void readReactions(base::weak_ptr<Data::Thread> weakThread) {
 		sublist ? sublist->sublistPeer()->input : MTPInputPeer()
 	)).done([=](const MTPmessages_AffectedHistory &result)
 	{
+		ReadingFor(&peer->session()).reactions.remove(key);
 		const auto offset = peer->session().api().applyAffectedHistory(
 			peer,
 			result);
@@ -260,7 +312,10 @@ void readReactions(base::weak_ptr<Data::Thread> weakThread) {
 		} else {
 			peer->owner().history(peer)->clearUnreadReactionsFor(rootId, sublist);
 		}
-	}).send();
+	}).fail([=]
+	{
+		ReadingFor(&peer->session()).reactions.remove(key);
+	}).afterDelay(kReadRequestDelay).send();
 }
 
 void MarkAsReadThread(not_null<Data::Thread*> thread) {
@@ -2132,12 +2132,12 @@ void PeerListContent::searchQueryChanged(QString query) {
 				auto searchWordInNames = [](
 						not_null<PeerListRow*> row,
 						const QString &searchWord) {
-					for (auto &nameWord : row->generateNameWords()) {
-						if (nameWord.startsWith(searchWord)) {
-							return true;
-						}
-					}
-					return false;
+					// Name words are sorted, so all the words starting
+					// with the search word follow right after it.
+					const auto &nameWords = row->generateNameWords();
+					const auto i = nameWords.lower_bound(searchWord);
+					return (i != nameWords.end())
+						&& i->startsWith(searchWord);
 				};
 				auto allSearchWordsInNames = [&](
 						not_null<PeerListRow*> row) {
@@ -23,6 +23,7 @@ namespace Calls::Group {
 namespace {
 
 constexpr auto kBlurRadius = 15;
+constexpr auto kBlurredUserpicMaxSize = 320;
 
 } // namespace
 
@@ -75,14 +76,21 @@ void Viewport::RendererSW::validateUserpicFrame(
 	} else if (!data.userpicFrame.isNull()) {
 		return;
 	}
-	const auto size = tile->trackOrUserpicSize();
+	// The blurred userpic is stretched to the tile anyway, so blur
+	// a smaller image with a proportionally smaller radius instead of
+	// blurring a userpic as large as the video track.
+	const auto size = tile->trackOrUserpicSize().width();
+	const auto blurSize = std::min(size, kBlurredUserpicMaxSize);
+	const auto blurRadius = (blurSize < size)
+		? std::max(kBlurRadius * blurSize / size, 1)
+		: kBlurRadius;
 	data.userpicFrame = Images::BlurLargeImage(
 		PeerData::GenerateUserpicImage(
 			tile->row()->peer(),
 			tile->row()->ensureUserpicView(),
-			size.width(),
+			blurSize,
 			0),
-		kBlurRadius);
+		blurRadius);
 }
 
 void Viewport::RendererSW::paintTile(
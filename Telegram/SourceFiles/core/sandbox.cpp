@@ -35,6 +35,96 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include <QtGui/qpa/qplatformscreen.h>
 
 namespace Core {
+namespace {
+
+constexpr auto kEventStatsPeriod = 60 * crl::time(1000);
+constexpr auto kSlowEventDuration = crl::time(16);
+constexpr auto kEventStatsTopCount = 5;
+
+// Main thread time spent in top level events, written to the debug log.
+// Events taking longer than a frame are grouped by receiver class
+// and event type, so that the top offenders are visible in the log.
+class EventStats final {
+public:
+	void record(
+			const char *receiver,
+			QEvent::Type type,
+			crl::time started,
+			crl::time finished) {
+		if (!_started) {
+			_started = started;
+		}
+		const auto duration = finished - started;
+		_busy += duration;
+		_longest = std::max(_longest, duration);
+		++_events;
+		if (duration >= kSlowEventDuration) {
+			auto &entry = _slow[Key{ receiver, int(type) }];
+			entry.total += duration;
+			entry.longest = std::max(entry.longest, duration);
+			++entry.count;
+			++_slowEvents;
+		}
+		if (finished - _started >= kEventStatsPeriod) {
+			log(finished);
+		}
+	}
+
+private:
+	using Key = std::pair<const char*, int>;
+	struct Entry {
+		crl::time total = 0;
+		crl::time longest = 0;
+		int count = 0;
+	};
+
+	void log(crl::time now) {
+		auto top = std::vector<std::pair<Key, Entry>>();
+		top.reserve(_slow.size());
+		for (const auto &[key, entry] : _slow) {
+			top.emplace_back(key, entry);
+		}
+		ranges::sort(top, ranges::greater(), [](const auto &pair) {
+			return pair.second.total;
+		});
+		auto offenders = QStringList();
+		for (const auto &[key, entry] : top | ranges::views::take(
+				kEventStatsTopCount)) {
+			offenders.push_back(u"%1:%2 (%3 times, %4ms, longest %5ms)"_q
+				.arg(key.first)
+				.arg(key.second)
+				.arg(entry.count)
+				.arg(entry.total)
+				.arg(entry.longest));
+		}
+		DEBUG_LOG(("Sandbox Stats: %1 events in %2ms, busy %3ms, "
+			"longest %4ms, over a frame %5. Top: %6"
+			).arg(_events
+			).arg(now - _started
+			).arg(_busy
+			).arg(_longest
+			).arg(_slowEvents
+			).arg(offenders.isEmpty()
+				? u"none"_q
+				: offenders.join(u", "_q)));
+		*this = EventStats();
+	}
+
+	base::flat_map<Key, Entry> _slow;
+	crl::time _started = 0;
+	crl::time _busy = 0;
+	crl::time _longest = 0;
+	int _events = 0;
+	int _slowEvents = 0;
+
+};
+
+[[nodiscard]] EventStats &MainThreadEventStats() {
+	static auto result = EventStats();
+	return result;
+}
+
+} // namespace
 
 bool Sandbox::QuitOnStartRequested = false;
 
@@ -522,6 +612,7 @@ void Sandbox::registerEnterFromEventLoop() {
 	if (_eventNestingLevel > _loopNestingLevel) {
 		_previousLoopNestingLevels.push_back(_loopNestingLevel);
 		_loopNestingLevel = _eventNestingLevel;
+		++_enteredLoopsCount;
 	}
 }
 
@@ -538,6 +629,25 @@ bool Sandbox::notify(QObject *receiver, QEvent *e) {
 		return notifyOrInvoke(receiver, e);
 	}
 
+	const auto measure = !_eventNestingLevel && Logs::DebugEnabled();
+	const auto started = measure ? crl::now() : crl::time();
+	const auto receiverName = (measure && receiver)
+		? receiver->metaObject()->className()
+		: "";
+	const auto type = e->type();
+	const auto loops = _enteredLoopsCount;
+	const auto stats = gsl::finally([&] {
+		// The wrap below is destroyed first, with the postponed calls.
+		// Events that ran a nested event loop are not counted.
+		if (measure && loops == _enteredLoopsCount) {
+			MainThreadEventStats().record(
+				receiverName,
+				type,
+				started,
+				crl::now());
+		}
+	});
+
 	const auto wrap = createEventNestingLevel();
 	if (e->type() == QEvent::UpdateRequest) {
 		const auto weak = QPointer<QObject>(receiver);
@@ -111,6 +111,7 @@ private:
 	int _eventNestingLevel = 0;
 	int _loopNestingLevel = 0;
 	std::vector<int> _previousLoopNestingLevels;
+	int _enteredLoopsCount = 0;
 	std::vector<PostponedCall> _postponedCalls;
 
 	std::unique_ptr<Application> _application;
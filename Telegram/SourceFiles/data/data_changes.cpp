@@ -23,12 +23,50 @@ void Changes::Manager<DataType, UpdateType>::updated(
 			flags |= i->second;
 			_updates.erase(i);
 		}
-		_stream.fire({ data, flags });
+		fire({ data, flags });
 	} else {
 		_updates[data] |= flags;
 	}
 }
 
+template <typename DataType, typename UpdateType>
+void Changes::Manager<DataType, UpdateType>::fire(UpdateType &&update) {
+	const auto streams = _streamsByData;
+	const auto &[data, flags] = update;
+	const auto i = streams->map.find(data);
+	if (i != end(streams->map)) {
+		// Entries are removed only when no stream is being fired,
+		// so that consumers may unsubscribe from their handlers.
+		++streams->firing;
+		i->second.stream.fire_copy(update);
+		if (!--streams->firing && streams->hasUnused) {
+			streams->hasUnused = false;
+			for (auto j = begin(streams->map); j != end(streams->map);) {
+				if (!j->second.consumers) {
+					j = streams->map.erase(j);
+				} else {
+					++j;
+				}
+			}
+		}
+	}
+	_stream.fire(std::move(update));
+}
+
+template <typename DataType, typename UpdateType>
+void Changes::Manager<DataType, UpdateType>::Unsubscribed(
+		not_null<DataStreams*> streams,
+		not_null<DataType*> data) {
+	const auto i = streams->map.find(data);
+	if (i == end(streams->map) || --i->second.consumers > 0) {
+		return;
+	} else if (streams->firing) {
+		streams->hasUnused = true;
+	} else {
+		streams->map.erase(i);
+	}
+}
+
 template <typename DataType, typename UpdateType>
 void Changes::Manager<DataType, UpdateType>::sendRealtimeNotifications(
 		not_null<DataType*> data,
@@ -54,10 +92,29 @@ template <typename DataType, typename UpdateType>
 rpl::producer<UpdateType> Changes::Manager<DataType, UpdateType>::updates(
 		not_null<DataType*> data,
 		Flags flags) const {
-	return _stream.events(
-	) | rpl::filter([=](const UpdateType &update) {
-		const auto &[updateData, updateFlags] = update;
-		return (updateData == data) && (updateFlags & flags);
+	const auto weak = std::weak_ptr<DataStreams>(_streamsByData);
+	return rpl::make_producer<UpdateType>([=](auto consumer) {
+		auto result = rpl::lifetime();
+		const auto streams = weak.lock();
+		if (!streams) {
+			return result;
+		}
+		auto &entry = streams->map[data];
+		++entry.consumers;
+		result.add([=] {
+			if (const auto streams = weak.lock()) {
+				Unsubscribed(streams.get(), data);
+			}
+		});
+		entry.stream.events(
+		) | rpl::start_with_next_done([=](const UpdateType &update) {
+			if (update.flags & flags) {
+				consumer.put_next_copy(update);
+			}
+		}, [=] {
+			consumer.put_done();
+		}, result);
+		return result;
 	});
 }
 
@@ -84,7 +141,7 @@ void Changes::Manager<DataType, UpdateType>::drop(not_null<DataType*> data) {
 template <typename DataType, typename UpdateType>
 void Changes::Manager<DataType, UpdateType>::sendNotifications() {
 	for (const auto &[data, flags] : base::take(_updates)) {
-		_stream.fire({ data, flags });
+		fire({ data, flags });
 	}
 }
 
@@ -430,14 +430,33 @@ private:
 	private:
 		static constexpr auto kCount = details::CountBit<Flag>() + 1;
 
+		struct DataStream {
+			rpl::event_stream<UpdateType> stream;
+			int consumers = 0;
+		};
+		struct DataStreams {
+			std::map<not_null<DataType*>, DataStream> map;
+			int firing = 0;
+			bool hasUnused = false;
+		};
+
 		void sendRealtimeNotifications(
 			not_null<DataType*> data,
 			Flags flags);
+		void fire(UpdateType &&update);
+		static void Unsubscribed(
+			not_null<DataStreams*> streams,
+			not_null<DataType*> data);
 
 		std::array<rpl::event_stream<UpdateType>, kCount> _realtimeStreams;
 		base::flat_map<not_null<DataType*>, Flags> _updates;
 		rpl::event_stream<UpdateType> _stream;
 
+		// Subscriptions to a single object get their own streams, so that
+		// each update isn't checked by every such subscriber.
+		const std::shared_ptr<DataStreams> _streamsByData
+			= std::make_shared<DataStreams>();
+
 	};
 
 	void scheduleNotifications();
@@ -365,23 +365,32 @@ bool ChatFilter::contains(
 	}();
 	if (_never.contains(history)) {
 		return false;
+	} else if (!(_flags & flag)) {
+		return _always.contains(history);
 	}
-	const auto state = (_flags & (Flag::NoMuted | Flag::NoRead))
-		? history->chatListBadgesState()
-		: Dialogs::BadgesState();
-	return false
-		|| ((_flags & flag)
-			&& (!(_flags & Flag::NoMuted)
-				|| !history->muted()
-				|| (state.mention
-					&& history->folderKnown()
-					&& !history->folder()))
-			&& (!(_flags & Flag::NoRead)
-				|| state.unread
-				|| state.mention
-				|| (!ignoreFakeUnread && history->fakeUnreadWhileOpened()))
-			&& (!(_flags & Flag::NoArchived)
-				|| (history->folderKnown() && !history->folder())))
+
+	// Check the cheap conditions first and compute the badges state
+	// only once and only if some of the remaining conditions need it.
+	const auto inMainList = [&] {
+		return history->folderKnown() && !history->folder();
+	};
+	if ((_flags & Flag::NoArchived) && !inMainList()) {
+		return _always.contains(history);
+	}
+	auto state = std::optional<Dialogs::BadgesState>();
+	const auto badges = [&]() -> const Dialogs::BadgesState & {
+		if (!state) {
+			state = history->chatListBadgesState();
+		}
+		return *state;
+	};
+	return ((!(_flags & Flag::NoMuted)
+			|| !history->muted()
+			|| (badges().mention && inMainList()))
+		&& (!(_flags & Flag::NoRead)
+			|| badges().unread
+			|| badges().mention
+			|| (!ignoreFakeUnread && history->fakeUnreadWhileOpened())))
 		|| _always.contains(history);
 }
 
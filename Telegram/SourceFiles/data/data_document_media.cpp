@@ -88,6 +88,14 @@ enum class FileType {
 		|| (size.width() * size.height() > kReadAreaLimit)) {
 		return QImage();
 	}
+	if (size.width() > kWallPaperThumbnailLimit
+		|| size.height() > kWallPaperThumbnailLimit) {
+		// JPEG is decoded right in the target size, without full decode.
+		reader.setScaledSize(size.scaled(
+			kWallPaperThumbnailLimit,
+			kWallPaperThumbnailLimit,
+			Qt::KeepAspectRatio));
+	}
 	auto result = reader.read();
 	if (!result.width() || !result.height()) {
 		return QImage();
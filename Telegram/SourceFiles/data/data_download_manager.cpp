@@ -371,6 +371,9 @@ void DownloadManager::clearIfFinished() {
 
 void DownloadManager::deleteFiles(const std::vector<GlobalMsgId> &ids) {
 	auto descriptor = DeleteFilesDescriptor();
+	auto removing = base::flat_map<
+		not_null<Main::Session*>,
+		base::flat_map<HistoryItem*, GlobalMsgId>>();
 	for (const auto &id : ids) {
 		if (const auto item = MessageByGlobalId(id)) {
 			const auto session = &item->history()->session();
@@ -386,27 +389,46 @@ void DownloadManager::deleteFiles(const std::vector<GlobalMsgId> &ids) {
 			if (j != end(data.downloading)) {
 				cancel(data, j);
 			}
+			if (_loaded.contains(item)) {
+				removing[session].emplace(item, id);
+			}
+		}
+	}
 
-			const auto k = ranges::find(data.downloaded, item, ByItem);
-			if (k != end(data.downloaded)) {
-				const auto document = k->object->document;
-				descriptor.files.emplace(k->path, DocumentDescriptor{
-					.sessionUniqueId = id.sessionUniqueId,
-					.documentId = document ? document->id : DocumentId(),
-					.itemId = id.itemId,
-				});
-				_loaded.remove(item);
-				_generated.remove(item);
-				if (document) {
-					_generatedDocuments.remove(document);
-				}
-				data.downloaded.erase(k);
-				_loadedRemoved.fire_copy(item);
-
-				descriptor.sessions.emplace(session);
+	// Erase all the requested entries in a single pass over each list,
+	// instead of searching and erasing from the vector one by one.
+	auto removed = std::vector<not_null<HistoryItem*>>();
+	for (const auto &[session, items] : removing) {
+		auto &data = sessionData(session);
+		const auto from = ranges::remove_if(data.downloaded, [&](
+				const DownloadedId &entry) {
+			const auto item = ByItem(entry);
+			const auto i = items.find(item);
+			if (i == end(items)) {
+				return false;
 			}
+			const auto document = entry.object->document;
+			descriptor.files.emplace(entry.path, DocumentDescriptor{
+				.sessionUniqueId = i->second.sessionUniqueId,
+				.documentId = document ? document->id : DocumentId(),
+				.itemId = i->second.itemId,
+			});
+			_loaded.remove(item);
+			_generated.remove(item);
+			if (document) {
+				_generatedDocuments.remove(document);
+			}
+			removed.push_back(item);
+			return true;
+		});
+		if (from != end(data.downloaded)) {
+			data.downloaded.erase(from, end(data.downloaded));
+			descriptor.sessions.emplace(session);
 		}
 	}
+	for (const auto item : removed) {
+		_loadedRemoved.fire_copy(item);
+	}
 	finishFilesDelete(std::move(descriptor));
 }
 
@@ -321,8 +321,32 @@ const GroupCallParticipant *GroupCall::participantByPeer(
 
 GroupCallParticipant *GroupCall::findParticipant(
 		not_null<PeerData*> peer) {
-	const auto i = ranges::find(_participants, peer, &Participant::peer);
-	return (i != end(_participants)) ? &*i : nullptr;
+	const auto i = _participantIndexByPeer.find(peer);
+	return (i != end(_participantIndexByPeer))
+		? &_participants[i->second]
+		: nullptr;
+}
+
+void GroupCall::addParticipantEndpoints(const Participant &participant) {
+	const auto add = [&](const std::string &endpoint) {
+		if (!endpoint.empty()) {
+			_participantPeerByEndpoint.emplace(endpoint, participant.peer);
+		}
+	};
+	add(participant.cameraEndpoint());
+	add(participant.screenEndpoint());
+}
+
+void GroupCall::removeParticipantEndpoints(const Participant &participant) {
+	const auto remove = [&](const std::string &endpoint) {
+		const auto i = _participantPeerByEndpoint.find(endpoint);
+		if (i != end(_participantPeerByEndpoint)
+			&& i->second == participant.peer) {
+			_participantPeerByEndpoint.erase(i);
+		}
+	};
+	remove(participant.cameraEndpoint());
+	remove(participant.screenEndpoint());
 }
 
 const GroupCallParticipant *GroupCall::participantByEndpoint(
@@ -330,13 +354,10 @@ const GroupCallParticipant *GroupCall::participantByEndpoint(
 	if (endpoint.empty()) {
 		return nullptr;
 	}
-	for (const auto &participant : _participants) {
-		if (GetCameraEndpoint(participant.videoParams) == endpoint
-			|| GetScreenEndpoint(participant.videoParams) == endpoint) {
-			return &participant;
-		}
-	}
-	return nullptr;
+	const auto i = _participantPeerByEndpoint.find(endpoint);
+	return (i != end(_participantPeerByEndpoint))
+		? participantByPeer(i->second)
+		: nullptr;
 }
 
 rpl::producer<> GroupCall::participantsReloaded() {
@@ -473,8 +494,10 @@ void GroupCall::processFullCallFields(const MTPphone_GroupCall &call) {
 		const auto nextOffset = qs(data.vparticipants_next_offset());
 		data.vcall().match([&](const MTPDgroupCall &data) {
 			_participants.clear();
+			_participantIndexByPeer.clear();
 			_speakingByActiveFinishes.clear();
 			_participantPeerByAudioSsrc.clear();
+			_participantPeerByEndpoint.clear();
 			_allParticipantsLoaded = false;
 
 			applyParticipantsSlice(
@@ -690,10 +713,10 @@ void GroupCall::applyParticipantsSlice(
 			const auto participantPeerId = peerFromMTP(data.vpeer());
 			const auto participantPeer = _peer->owner().peer(
 				participantPeerId);
-			const auto i = ranges::find(
-				_participants,
-				participantPeer,
-				&Participant::peer);
+			const auto index = _participantIndexByPeer.find(participantPeer);
+			const auto i = (index != end(_participantIndexByPeer))
+				? (begin(_participants) + index->second)
+				: end(_participants);
 			if (data.is_left()) {
 				if (i != end(_participants)) {
 					auto update = ParticipantUpdate{
@@ -702,8 +725,16 @@ void GroupCall::applyParticipantsSlice(
 					_participantPeerByAudioSsrc.erase(i->ssrc);
 					_participantPeerByAudioSsrc.erase(
 						GetAdditionalAudioSsrc(i->videoParams));
+					removeParticipantEndpoints(*i);
 					_speakingByActiveFinishes.remove(participantPeer);
+					const auto removed = index->second;
+					_participantIndexByPeer.erase(index);
 					_participants.erase(i);
+					for (auto &[peer, other] : _participantIndexByPeer) {
+						if (other > removed) {
+							--other;
+						}
+					}
 					if (sliceSource != ApplySliceSource::FullReloaded) {
 						_participantUpdates.fire(std::move(update));
 					}
@@ -786,6 +817,10 @@ void GroupCall::applyParticipantsSlice(
 						additional,
 						participantPeer);
 				}
+				addParticipantEndpoints(value);
+				_participantIndexByPeer.emplace(
+					participantPeer,
+					int(_participants.size()));
 				_participants.push_back(value);
 			} else {
 				if (i->ssrc != value.ssrc) {
@@ -807,6 +842,13 @@ void GroupCall::applyParticipantsSlice(
 							participantPeer);
 					}
 				}
+				const auto endpointsChanged
+					= (i->cameraEndpoint() != value.cameraEndpoint())
+					|| (i->screenEndpoint() != value.screenEndpoint());
+				if (endpointsChanged) {
+					removeParticipantEndpoints(*i);
+					addParticipantEndpoints(value);
+				}
 				*i = value;
 			}
 			if (data.is_just_joined()) {
@@ -1043,10 +1085,8 @@ void GroupCall::requestUnknownParticipants() {
 		}
 		for (const auto &[id, when] : participantPeerIds) {
 			if (const auto participantPeer = _peer->owner().peerLoaded(id)) {
-				const auto isParticipant = ranges::contains(
-					_participants,
-					not_null{ participantPeer },
-					&Participant::peer);
+				const auto isParticipant = _participantIndexByPeer.contains(
+					participantPeer);
 				if (isParticipant) {
 					applyActiveUpdate(id, when, participantPeer);
 				}
@@ -235,6 +235,8 @@ private:
 	[[nodiscard]] bool processSavedFullCall();
 	void finishParticipantsSliceRequest();
 	[[nodiscard]] Participant *findParticipant(not_null<PeerData*> peer);
+	void addParticipantEndpoints(const Participant &participant);
+	void removeParticipantEndpoints(const Participant &participant);
 
 	const CallId _id = 0;
 	const uint64 _accessHash = 0;
@@ -254,7 +256,11 @@ private:
 	std::optional<MTPphone_GroupCall> _savedFull;
 
 	std::vector<Participant> _participants;
+	base::flat_map<not_null<PeerData*>, int> _participantIndexByPeer;
 	base::flat_map<uint32, not_null<PeerData*>> _participantPeerByAudioSsrc;
+	base::flat_map<
+		std::string,
+		not_null<PeerData*>> _participantPeerByEndpoint;
 	base::flat_map<not_null<PeerData*>, crl::time> _speakingByActiveFinishes;
 	base::Timer _speakingByActiveFinishTimer;
 	QString _nextOffset;
@@ -169,6 +169,22 @@ void Histories::clearAll() {
 	_map.clear();
 }
 
+int Histories::residentItemsCount() const {
+	auto result = 0;
+	for (const auto &[peerId, history] : _map) {
+		result += history->residentItemsCount();
+	}
+	return result;
+}
+
+int Histories::residentViewsCount() const {
+	auto result = 0;
+	for (const auto &[peerId, history] : _map) {
+		result += history->residentViewsCount();
+	}
+	return result;
+}
+
 void Histories::readInbox(not_null<History*> history) {
 	DEBUG_LOG(("Reading: readInbox called."));
 	if (history->lastServerMessageKnown()) {
@@ -58,6 +58,9 @@ public:
 	void unloadAll();
 	void clearAll();
 
+	[[nodiscard]] int residentItemsCount() const;
+	[[nodiscard]] int residentViewsCount() const;
+
 	void readInbox(not_null<History*> history);
 	void readInboxTill(not_null<HistoryItem*> item);
 	void readInboxTill(not_null<History*> history, MsgId tillId);
@@ -2699,7 +2699,10 @@ proceed:
 void Session::processMessages(
 		const QVector<MTPMessage> &data,
 		NewMessageType type) {
-	auto indices = base::flat_map<uint64, int>();
+	// Collect and sort once instead of inserting into a flat_map,
+	// large differences may contain thousands of messages.
+	auto indices = std::vector<std::pair<uint64, int>>();
+	indices.reserve(data.size());
 	for (int i = 0, l = data.size(); i != l; ++i) {
 		const auto &message = data[i];
 		if (message.type() == mtpc_message) {
@@ -2711,8 +2714,9 @@ void Session::processMessages(
 			}
 		}
 		const auto id = IdFromMessage(message); // Only 32 bit values here.
-		indices.emplace((uint64(uint32(id.bare)) << 32) | uint64(i), i);
+		indices.emplace_back((uint64(uint32(id.bare)) << 32) | uint64(i), i);
 	}
+	ranges::sort(indices);
 	for (const auto &[position, index] : indices) {
 		addNewMessage(
 			data[index],
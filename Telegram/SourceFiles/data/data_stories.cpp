@@ -2467,6 +2467,11 @@ bool Stories::rebuildPreloadSources(StorySourcesList list) {
 	auto now = std::vector<FullStoryId>();
 	auto processed = 0;
 	for (const auto &source : _sources[index]) {
+		if (!source.unreadCount) {
+			// Fully read sources are rarely opened,
+			// don't spend traffic and preload slots on them.
+			continue;
+		}
 		const auto i = _all.find(source.id);
 		if (i != end(_all)) {
 			if (const auto id = i->second.toOpen().id) {
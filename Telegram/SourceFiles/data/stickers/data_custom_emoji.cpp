@@ -46,6 +46,7 @@ namespace Data {
 namespace {
 
 constexpr auto kMaxPerRequest = 100;
+constexpr auto kRepaintLateLogThreshold = crl::time(100);
 #if 0 // inject-to-on_main
 constexpr auto kUnsubscribeUpdatesDelay = 3 * crl::time(1000);
 #endif
@@ -954,11 +955,13 @@ void CustomEmojiManager::invokeRepaints() {
 	}
 	const auto now = crl::now();
 	auto repaint = std::vector<base::weak_ptr<Ui::CustomEmoji::Instance>>();
+	auto late = crl::time(0);
 	for (auto i = begin(_repaints); i != end(_repaints);) {
 		if (i->second.when > now) {
 			++i;
 			continue;
 		}
+		late = std::max(late, now - i->second.when);
 		auto &list = i->second.instances;
 		if (repaint.empty()) {
 			repaint = std::move(list);
@@ -970,8 +973,22 @@ void CustomEmojiManager::invokeRepaints() {
 		}
 		i = _repaints.erase(i);
 	}
+	if (late >= kRepaintLateLogThreshold) {
+		// The main thread was busy, the repaints are backlogged.
+		DEBUG_LOG(("Custom Emoji: %1 repaints done %2ms late."
+			).arg(repaint.size()
+			).arg(late));
+	}
 	if (!repaint.empty()) {
+		// The same instance may be waiting in several bunches,
+		// repaint each one only once per invocation.
+		const auto proj = [](const auto &weak) { return weak.get(); };
+		ranges::sort(repaint, ranges::less(), proj);
+		repaint.erase(
+			ranges::unique(repaint, ranges::equal_to(), proj),
+			end(repaint));
 		for (const auto &weak : repaint) {
+			// Repainting one instance may destroy the others.
 			if (const auto strong = weak.get()) {
 				strong->repaint();
 			}
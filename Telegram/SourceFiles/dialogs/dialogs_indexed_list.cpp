@@ -237,12 +237,8 @@ std::vector<not_null<Row*>> IndexedList::filtered(
 	for (const auto &row : *minimal) {
 		const auto &nameWords = row->entry()->chatListNameWords();
 		const auto found = [&](const QString &word) {
-			for (const auto &name : nameWords) {
-				if (name.startsWith(word)) {
-					return true;
-				}
-			}
-			return false;
+			const auto i = nameWords.lower_bound(word);
+			return (i != nameWords.end()) && i->startsWith(word);
 		};
 		const auto allFound = [&] {
 			for (const auto &word : words) {
@@ -84,19 +84,30 @@ void List::adjustByName(not_null<Row*> row) {
 void List::adjustByDate(not_null<Row*> row) {
 	Expects(_sortMode == SortMode::Date);
 
+	// All the other rows are sorted by the key, so the new position
+	// is found with a binary search. This matters for filter lists,
+	// where the sort key is computed on each request.
 	const auto key = row->sortKey(_filterId);
+	const auto proj = [&](not_null<Row*> other) {
+		return other->sortKey(_filterId);
+	};
 	const auto index = row->index();
 	const auto i = _rows.begin() + index;
-	const auto before = std::find_if(i + 1, _rows.end(), [&](Row *row) {
-		return (row->sortKey(_filterId) <= key);
-	});
+	const auto before = ranges::lower_bound(
+		i + 1,
+		_rows.end(),
+		key,
+		ranges::greater(),
+		proj);
 	if (before != i + 1) {
 		rotate(i, i + 1, before);
 	} else {
-		const auto from = std::make_reverse_iterator(i);
-		const auto after = std::find_if(from, _rows.rend(), [&](Row *row) {
-			return (row->sortKey(_filterId) >= key);
-		}).base();
+		const auto after = ranges::upper_bound(
+			_rows.begin(),
+			i,
+			key,
+			ranges::greater(),
+			proj);
 		if (after != i) {
 			rotate(after, i, i + 1);
 		}
@@ -46,6 +46,10 @@ public:
 	[[nodiscard]] UnreadState unreadState() const;
 	[[nodiscard]] rpl::producer<UnreadState> unreadStateChanges() const;
 
+	// While the returned guard is alive, unread state changes are
+	// accumulated and reported once when the last guard is destroyed.
+	[[nodiscard]] inline auto holdUnreadStateChanges();
+
 	[[nodiscard]] not_null<IndexedList*> indexed();
 	[[nodiscard]] not_null<const IndexedList*> indexed() const;
 	[[nodiscard]] not_null<PinnedList*> pinned();
@@ -66,6 +70,8 @@ private:
 	UnreadState _unreadState;
 	UnreadState _cloudUnreadState;
 	rpl::event_stream<UnreadState> _unreadStateChanges;
+	std::optional<UnreadState> _unreadStateHeldWas;
+	int _unreadStateChangesHeld = 0;
 	rpl::variable<int> _fullListSize = 0;
 	int _cloudListSize = 0;
 
@@ -77,6 +83,11 @@ private:
 };
 
 auto MainList::unreadStateChangeNotifier(bool notify) {
+	const auto held = (_unreadStateChangesHeld > 0);
+	if (notify && held && !_unreadStateHeldWas) {
+		_unreadStateHeldWas = unreadState();
+	}
+	notify = notify && !held;
 	const auto wasState = notify ? unreadState() : UnreadState();
 	return gsl::finally([=] {
 		if (notify) {
@@ -85,4 +96,15 @@ auto MainList::unreadStateChangeNotifier(bool notify) {
 	});
 }
 
+auto MainList::holdUnreadStateChanges() {
+	++_unreadStateChangesHeld;
+	return gsl::finally([=] {
+		if (!--_unreadStateChangesHeld) {
+			if (const auto wasState = base::take(_unreadStateHeldWas)) {
+				_unreadStateChanges.fire_copy(*wasState);
+			}
+		}
+	});
+}
+
 } // namespace Dialogs
@@ -1020,18 +1020,23 @@ std::pair<QString, QSize> WriteImageThumb(
 		|| size.height() >= kMaxImageSize) {
 		return {};
 	}
-	auto image = reader.read();
-	if (image.isNull()) {
+	const auto finalSize = convertSize(size);
+	if (finalSize.isEmpty()) {
 		return {};
+	} else if (finalSize.width() < size.width()
+		&& finalSize.height() < size.height()) {
+		// Let the decoder skip the detail we don't need (JPEG DCT scaling).
+		reader.setScaledSize(finalSize);
 	}
-	const auto finalSize = convertSize(image.size());
-	if (finalSize.isEmpty()) {
+	auto image = reader.read();
+	if (image.isNull()) {
 		return {};
+	} else if (image.size() != finalSize) {
+		image = std::move(image).scaled(
+			finalSize,
+			Qt::IgnoreAspectRatio,
+			Qt::SmoothTransformation);
 	}
-	image = std::move(image).scaled(
-		finalSize,
-		Qt::IgnoreAspectRatio,
-		Qt::SmoothTransformation);
 	const auto finalFormat = format ? *format : reader.format();
 	const auto finalQuality = quality ? *quality : reader.quality();
 	const auto lastSlash = largePath.lastIndexOf('/');
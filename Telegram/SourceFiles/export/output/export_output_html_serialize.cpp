@@ -0,0 +1,115 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "export/output/export_output_html_serialize.h"
+
+namespace Export {
+namespace Output {
+namespace {
+
+[[nodiscard]] bool IsLineSeparator(const char *p, const char *end) {
+	return (*p == char(0xE2))
+		&& (p + 2 < end)
+		&& (*(p + 1) == char(0x80))
+		&& (*(p + 2) == char(0xA8) || *(p + 2) == char(0xA9));
+}
+
+[[nodiscard]] int SerializedCharSize(const char *p, const char *end) {
+	switch (*p) {
+	case '\n': return 4;
+	case '"': return 6;
+	case '&': return 5;
+	case '\'': return 6;
+	case '<': return 4;
+	case '>': return 4;
+	}
+	return (*p >= 0 && *p < 32)
+		? 6
+		: IsLineSeparator(p, end)
+		? 4
+		: 1;
+}
+
+} // namespace
+
+QByteArray SerializeString(const QByteArray &value) {
+	const auto size = value.size();
+	const auto begin = value.data();
+	const auto end = begin + size;
+
+	auto resultSize = 0;
+	for (auto p = begin; p != end; ++p) {
+		resultSize += SerializedCharSize(p, end);
+	}
+	if (resultSize == size) {
+		return value;
+	}
+
+	auto result = QByteArray();
+	result.reserve(resultSize);
+	for (auto p = begin; p != end; ++p) {
+		const auto ch = *p;
+		if (ch == '\n') {
+			result.append("<br>", 4);
+		} else if (ch == '"') {
+			result.append("&quot;", 6);
+		} else if (ch == '&') {
+			result.append("&amp;", 5);
+		} else if (ch == '\'') {
+			result.append("&apos;", 6);
+		} else if (ch == '<') {
+			result.append("&lt;", 4);
+		} else if (ch == '>') {
+			result.append("&gt;", 4);
+		} else if (ch >= 0 && ch < 32) {
+			result.append("&#x", 3).append('0' + (ch >> 4));
+			const auto left = (ch & 0x0F);
+			if (left >= 10) {
+				result.append('A' + (left - 10));
+			} else {
+				result.append('0' + left);
+			}
+			result.append(';');
+		} else if (ch == char(0xE2)
+			&& (p + 2 < end)
+			&& *(p + 1) == char(0x80)) {
+			if (*(p + 2) == char(0xA8)) { // Line separator.
+				result.append("<br>", 4);
+			} else if (*(p + 2) == char(0xA9)) { // Paragraph separator.
+				result.append("<br>", 4);
+			} else {
+				result.append(ch);
+			}
+		} else {
+			result.append(ch);
+		}
+	}
+	return result;
+}
+
+QByteArray SerializeList(const std::vector<QByteArray> &values) {
+	const auto count = values.size();
+	if (count == 1) {
+		return values[0];
+	} else if (count > 1) {
+		auto size = (count - 2) * 2 + 5;
+		for (const auto &value : values) {
+			size += value.size();
+		}
+		auto result = QByteArray();
+		result.reserve(size);
+		result.append(values[0]);
+		for (auto i = 1; i != count - 1; ++i) {
+			result.append(", ", 2).append(values[i]);
+		}
+		return result.append(" and ", 5).append(values[count - 1]);
+	}
+	return QByteArray();
+}
+
+} // namespace Output
+} // namespace Export
@@ -0,0 +1,21 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+#include <QtCore/QByteArray>
+
+#include <vector>
+
+namespace Export {
+namespace Output {
+
+[[nodiscard]] QByteArray SerializeString(const QByteArray &value);
+[[nodiscard]] QByteArray SerializeList(const std::vector<QByteArray> &values);
+
+} // namespace Output
+} // namespace Export
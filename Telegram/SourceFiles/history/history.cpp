@@ -164,6 +164,7 @@ void History::itemRemoved(not_null<HistoryItem*> item) {
 			}
 		}
 	}
+	_unloadedLocalMessages.remove(item);
 	checkChatListMessageRemoved(item);
 	itemVanished(item);
 	if (IsClientMsgId(item->id)) {
@@ -2582,6 +2583,62 @@ bool History::loadedAtBottom() const {
 	return _loadedAtBottom;
 }
 
+bool History::unloadBlocksAfter(int blockIndex) {
+	if (blockIndex < 0
+		|| blockIndex + 1 >= int(blocks.size())
+		|| isBuildingFrontBlock()) {
+		return false;
+	}
+	// Server messages come back with the newer slice and local ones
+	// are put back by date in checkLocalMessages(). The generated joined
+	// and new peer messages are created again there, sponsored messages
+	// are requested again by SponsoredMessages::request().
+	auto generated = std::vector<not_null<HistoryItem*>>();
+	auto hasSponsored = false;
+	for (auto i = blockIndex + 1; i != int(blocks.size()); ++i) {
+		for (const auto &view : blocks[i]->messages) {
+			const auto item = view->data();
+			if (item->isSponsored()) {
+				hasSponsored = true;
+			} else if (item == _joinedMessage
+				|| item == _newPeerNameChange
+				|| item == _newPeerPhotoChange) {
+				generated.push_back(item);
+			} else if (item->isDeleted()
+				|| (!item->isRegular()
+					&& !_clientSideMessages.contains(item))) {
+				_unloadedLocalMessages.emplace(item);
+			}
+		}
+	}
+	for (const auto &item : generated) {
+		item->destroy();
+	}
+	while (int(blocks.size()) > blockIndex + 1) {
+		// Removing the last view of a block deletes the block.
+		const auto block = blocks.back().get();
+		block->remove(block->messages.back().get());
+	}
+	if (hasSponsored) {
+		session().sponsoredMessages().clearItems(this);
+	}
+	_loadedAtBottom = false;
+	setHasPendingResizedItems();
+	return true;
+}
+
+int History::residentViewsCount() const {
+	auto result = 0;
+	for (const auto &block : blocks) {
+		result += int(block->messages.size());
+	}
+	return result;
+}
+
+int History::residentItemsCount() const {
+	return int(_items.size());
+}
+
 bool History::loadedAtTop() const {
 	return _loadedAtTop;
 }
@@ -3764,6 +3821,18 @@ void History::checkLocalMessages() {
 			insertMessageToBlocks(item);
 		}
 	}
+	auto &unloaded = _unloadedLocalMessages;
+	for (auto i = begin(unloaded); i != end(unloaded);) {
+		const auto item = *i;
+		if (item->mainView()) {
+			i = unloaded.erase(i);
+		} else if (goodDate(item->date())) {
+			insertMessageToBlocks(item);
+			i = unloaded.erase(i);
+		} else {
+			++i;
+		}
+	}
 	if (peer->isChannel()
 		&& !_joinedMessage
 		&& peer->asChannel()->inviter
@@ -240,6 +240,9 @@ public:
 
 	[[nodiscard]] bool loadedAtBottom() const; // last message is in the list
 	void setNotLoadedAtBottom();
+	bool unloadBlocksAfter(int blockIndex); // destroys views, keeps items
+	[[nodiscard]] int residentViewsCount() const;
+	[[nodiscard]] int residentItemsCount() const;
 	[[nodiscard]] bool loadedAtTop() const; // nothing was added after loading history back
 	[[nodiscard]] bool isReadyFor(MsgId msgId); // has messages for showing history at msgId
 	void getReadyFor(MsgId msgId);
@@ -642,6 +645,7 @@ private:
 	std::optional<HistoryItem*> _lastMessage;
 	std::optional<HistoryItem*> _lastServerMessage;
 	base::flat_set<not_null<HistoryItem*>> _clientSideMessages;
+	base::flat_set<not_null<HistoryItem*>> _unloadedLocalMessages;
 	std::unordered_set<std::unique_ptr<HistoryItem>> _items;
 
 	std::unique_ptr<Data::HistoryMessages> _messages;
@@ -204,6 +204,7 @@ namespace {
 constexpr auto kMessagesPerPageFirst = 30;
 constexpr auto kMessagesPerPage = 50;
 constexpr auto kPreloadHeightsCount = 3; // when 3 screens to scroll left make a preload request
+constexpr auto kKeepBlocksBelowScroll = 20; // ~1000 messages below the scroll top are kept
 constexpr auto kScrollToVoiceAfterScrolledMs = 1000;
 constexpr auto kSkipRepaintWhileScrollMs = 100;
 constexpr auto kShowMembersDropdownTimeoutMs = 300;
@@ -7419,12 +7420,31 @@ void HistoryWidget::addMessagesToFront(
 		not_null<PeerData*> peer,
 		const QVector<MTPMessage> &messages) {
 	_list->messagesReceived(peer, messages);
+	unloadFarBottomBlocks();
 	if (!_firstLoadRequest) {
 		updateHistoryGeometry();
 		updateBotKeyboard();
 	}
 }
 
+void HistoryWidget::unloadFarBottomBlocks() {
+	// While scrolling up the views far below the viewport are destroyed,
+	// they will be loaded again by loadMessagesDown() if needed.
+	const auto scrollTop = _history->scrollTopItem;
+	if (!scrollTop || (_migrated && !_migrated->isEmpty())) {
+		return;
+	}
+	const auto index = scrollTop->block()->indexInHistory();
+	const auto was = Logs::DebugEnabled()
+		? _history->residentViewsCount()
+		: 0;
+	if (_history->unloadBlocksAfter(index + kKeepBlocksBelowScroll)) {
+		DEBUG_LOG(("History Memory: Unloaded bottom blocks, views %1 -> %2."
+			).arg(was
+			).arg(_history->residentViewsCount()));
+	}
+}
+
 void HistoryWidget::addMessagesToBack(
 		not_null<PeerData*> peer,
 		const QVector<MTPMessage> &messages) {
@@ -606,6 +606,7 @@ private:
 	void messagesFailed(const MTP::Error &error, int requestId);
 	void addMessagesToFront(not_null<PeerData*> peer, const QVector<MTPMessage> &messages);
 	void addMessagesToBack(not_null<PeerData*> peer, const QVector<MTPMessage> &messages);
+	void unloadFarBottomBlocks();
 
 	void updateSendRestriction();
 	[[nodiscard]] Data::SendError computeSendRestriction() const;
@@ -10,6 +10,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "base/openssl_help.h"
 #include "base/unixtime.h"
 #include "iv/iv_data.h"
+#include "iv/iv_prepare_html.h"
 #include "lang/lang_keys.h"
 #include "ui/image/image_prepare.h"
 #include "ui/grouped_layout.h"
@@ -21,12 +22,6 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace Iv {
 namespace {
 
-struct Attribute {
-	QByteArray name;
-	std::optional<QByteArray> value;
-};
-using Attributes = std::vector<Attribute>;
-
 struct Photo {
 	uint64 id = 0;
 	int width = 0;
@@ -51,22 +46,6 @@ template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
 	return Number(base::SafeRound(value * 10000.) / 100.);
 };
 
-[[nodiscard]] QByteArray Escape(QByteArray value) {
-	auto result = QByteArray();
-	result.reserve(value.size());
-	for (const auto &ch : value) {
-		switch (ch) {
-		case '&': result.append("&amp;"); break;
-		case '<': result.append("&lt;"); break;
-		case '>': result.append("&gt;"); break;
-		case '"': result.append("&quot;"); break;
-		case '\'': result.append("&apos;"); break;
-		default: result.append(ch); break;
-		}
-	}
-	return result;
-}
-
 [[nodiscard]] QByteArray Date(TimeId date) {
 	return Escape(langDateTimeFull(base::unixtime::parse(date)).toUtf8());
 }
@@ -190,26 +169,6 @@ private:
 
 };
 
-[[nodiscard]] bool IsVoidElement(const QByteArray &name) {
-	// Thanks https://developer.mozilla.org/en-US/docs/Glossary/Void_element
-	static const auto voids = base::flat_set<QByteArray>{
-		"area"_q,
-		"base"_q,
-		"br"_q,
-		"col"_q,
-		"embed"_q,
-		"hr"_q,
-		"img"_q,
-		"input"_q,
-		"link"_q,
-		"meta"_q,
-		"source"_q,
-		"track"_q,
-		"wbr"_q,
-	};
-	return voids.contains(name);
-}
-
 [[nodiscard]] QByteArray ArrowSvg(bool left) {
 	const auto rotate = QByteArray(left ? "180" : "0");
 	return R"(
@@ -993,15 +952,7 @@ QByteArray Parser::tag(
 		const QByteArray &name,
 		const Attributes &attributes,
 		const QByteArray &body) {
-	auto list = QByteArrayList();
-	list.reserve(attributes.size());
-	for (auto &[name, value] : attributes) {
-		list.push_back(' ' + name + (value ? "=\"" + *value + "\"" : ""));
-	}
-	const auto serialized = list.join(QByteArray());
-	return (IsVoidElement(name) && body.isEmpty())
-		? ('<' + name + serialized + " />")
-		: ('<' + name + serialized + '>' + body + "</" + name + '>');
+	return Tag(name, attributes, body);
 }
 
 QByteArray Parser::rich(const MTPRichText &text) {
@@ -0,0 +1,96 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "iv/iv_prepare_html.h"
+
+#include "base/basic_types.h"
+#include "base/flat_set.h"
+
+#include <algorithm>
+#include <string_view>
+
+namespace Iv {
+
+QByteArray Escape(QByteArray value) {
+	const auto special = [](char ch) {
+		return (ch == '&')
+			|| (ch == '<')
+			|| (ch == '>')
+			|| (ch == '"')
+			|| (ch == '\'');
+	};
+	const auto from = std::find_if(value.cbegin(), value.cend(), special);
+	if (from == value.cend()) {
+		return value;
+	}
+	auto result = QByteArray();
+	result.reserve(value.size() + value.size() / 8 + 8);
+	result.append(value.constData(), int(from - value.cbegin()));
+	for (const auto ch : std::string_view(from, value.cend() - from)) {
+		switch (ch) {
+		case '&': result.append("&amp;"); break;
+		case '<': result.append("&lt;"); break;
+		case '>': result.append("&gt;"); break;
+		case '"': result.append("&quot;"); break;
+		case '\'': result.append("&apos;"); break;
+		default: result.append(ch); break;
+		}
+	}
+	return result;
+}
+
+bool IsVoidElement(const QByteArray &name) {
+	// Thanks https://developer.mozilla.org/en-US/docs/Glossary/Void_element
+	static const auto voids = base::flat_set<QByteArray>{
+		"area"_q,
+		"base"_q,
+		"br"_q,
+		"col"_q,
+		"embed"_q,
+		"hr"_q,
+		"img"_q,
+		"input"_q,
+		"link"_q,
+		"meta"_q,
+		"source"_q,
+		"track"_q,
+		"wbr"_q,
+	};
+	return voids.contains(name);
+}
+
+QByteArray Tag(
+		const QByteArray &name,
+		const Attributes &attributes,
+		const QByteArray &body) {
+	// Build the tag in a single buffer of the exact size.
+	const auto empty = IsVoidElement(name) && body.isEmpty();
+	auto size = 1 + name.size() + (empty
+		? 3
+		: (1 + body.size() + 2 + name.size() + 1));
+	for (const auto &[key, value] : attributes) {
+		size += 1 + key.size() + (value ? (value->size() + 3) : 0);
+	}
+	auto result = QByteArray();
+	result.reserve(size);
+	result.append('<').append(name);
+	for (const auto &[key, value] : attributes) {
+		result.append(' ').append(key);
+		if (value) {
+			result.append("=\"", 2).append(*value).append('"');
+		}
+	}
+	if (empty) {
+		result.append(" />", 3);
+	} else {
+		result.append('>').append(body).append("</", 2).append(name);
+		result.append('>');
+	}
+	return result;
+}
+
+} // namespace Iv
@@ -0,0 +1,30 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+#include <QtCore/QByteArray>
+
+#include <optional>
+#include <vector>
+
+namespace Iv {
+
+struct Attribute {
+	QByteArray name;
+	std::optional<QByteArray> value;
+};
+using Attributes = std::vector<Attribute>;
+
+[[nodiscard]] QByteArray Escape(QByteArray value);
+[[nodiscard]] bool IsVoidElement(const QByteArray &name);
+[[nodiscard]] QByteArray Tag(
+	const QByteArray &name,
+	const Attributes &attributes,
+	const QByteArray &body);
+
+} // namespace Iv
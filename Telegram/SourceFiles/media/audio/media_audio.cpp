@@ -34,7 +34,6 @@ namespace {
 
 constexpr auto kSuppressRatioAll = 0.2;
 constexpr auto kSuppressRatioSong = 0.05;
-constexpr auto kWaveformCounterBufferSize = 256 * 1024;
 
 QMutex AudioMutex;
 ALCdevice *AudioDevice = nullptr;
@@ -1542,8 +1541,6 @@ public:
 			return false;
 		}
 
-		QByteArray buffer;
-		buffer.reserve(kWaveformCounterBufferSize);
 		const auto samplesCount = samplesFrequency() * duration() / 1000;
 		int64 countbytes = sampleSize() * samplesCount;
 		int64 processed = 0;
@@ -1557,13 +1554,31 @@ public:
 
 		auto fmt = format();
 		auto peak = uint16(0);
-		auto callback = [&](uint16 sample) {
-			accumulate_max(peak, sample);
-			sumbytes += Media::Player::kWaveformSamplesCount;
-			if (sumbytes >= countbytes) {
-				sumbytes -= countbytes;
-				peaks.push_back(peak);
-				peak = 0;
+
+		// Reduce whole runs of samples between the peak boundaries,
+		// the plain max loop is vectorized by the compiler.
+		const auto reduce = [&](auto sampleTag, bytes::const_span sampleBytes) {
+			using SampleType = decltype(sampleTag);
+			const auto samples = reinterpret_cast<const SampleType*>(
+				sampleBytes.data());
+			const auto count = int64(sampleBytes.size() / sizeof(SampleType));
+			constexpr auto step = int64(Media::Player::kWaveformSamplesCount);
+			for (auto from = int64(0); from != count;) {
+				const auto tillPeak = (countbytes - sumbytes + step - 1)
+					/ step;
+				const auto till = std::min(count, from + tillPeak);
+				for (auto i = from; i != till; ++i) {
+					accumulate_max(
+						peak,
+						Media::Audio::ReadOneSample(samples[i]));
+				}
+				sumbytes += (till - from) * step;
+				from = till;
+				if (sumbytes >= countbytes) {
+					sumbytes -= countbytes;
+					peaks.push_back(peak);
+					peak = 0;
+				}
 			}
 		};
 		while (processed < countbytes) {
@@ -1579,9 +1594,9 @@ public:
 			const auto sampleBytes = v::get<bytes::const_span>(result);
 			Assert(!sampleBytes.empty());
 			if (fmt == AL_FORMAT_MONO8 || fmt == AL_FORMAT_STEREO8) {
-				Media::Audio::IterateSamples<uchar>(sampleBytes, callback);
+				reduce(uchar(), sampleBytes);
 			} else if (fmt == AL_FORMAT_MONO16 || fmt == AL_FORMAT_STEREO16) {
-				Media::Audio::IterateSamples<int16>(sampleBytes, callback);
+				reduce(int16(), sampleBytes);
 			}
 			processed += sampleBytes.size();
 		}
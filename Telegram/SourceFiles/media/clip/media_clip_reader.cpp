@@ -33,9 +33,20 @@ namespace Media {
 namespace Clip {
 namespace {
 
-constexpr auto kClipThreadsCount = 8;
+constexpr auto kClipThreadsCountMin = 2;
+constexpr auto kClipThreadsCountMax = 8;
 constexpr auto kAverageGifSize = 320 * 240;
 constexpr auto kWaitBeforeGifPause = crl::time(200);
+constexpr auto kFrameLateThreshold = crl::time(40);
+constexpr auto kFrameStatsPeriod = 60 * crl::time(1000);
+
+[[nodiscard]] int ClipThreadsCount() {
+	static const auto result = std::clamp(
+		QThread::idealThreadCount(),
+		kClipThreadsCountMin,
+		kClipThreadsCountMax);
+	return result;
+}
 
 QImage PrepareFrame(
 		const FrameRequest &request,
@@ -148,6 +159,7 @@ private:
 	ReaderPointers::iterator unsafeFindReaderPointer(ReaderPrivate *reader);
 
 	bool handleProcessResult(ReaderPrivate *reader, ProcessResult result, crl::time ms);
+	void countFrame(crl::time when, crl::time ms);
 
 	enum ResultHandleState {
 		ResultHandleRemove,
@@ -163,6 +175,12 @@ private:
 	QThread *_processingInThread = nullptr;
 	bool _needReProcess = false;
 
+	// Visible readers processed and processed late, for the debug log.
+	crl::time _statsStarted = 0;
+	crl::time _statsMostLate = 0;
+	int _statsFrames = 0;
+	int _statsLateFrames = 0;
+
 };
 
 namespace {
@@ -203,19 +221,22 @@ Reader::Reader(const QByteArray &data, Callback &&callback)
 }
 
 void Reader::init(const Core::FileLocation &location, const QByteArray &data) {
-	if (Workers.size() < kClipThreadsCount) {
+	_threadIndex = Workers.empty()
+		? -1
+		: base::RandomIndex(Workers.size());
+	auto loadLevel = 0x7FFFFFFF;
+	for (int i = 0, l = int(Workers.size()); i < l; ++i) {
+		const auto level = Workers[i]->manager.loadLevel();
+		if (level < loadLevel) {
+			_threadIndex = i;
+			loadLevel = level;
+		}
+	}
+	// Start a new thread only if there is no idle one.
+	if (_threadIndex < 0
+		|| (loadLevel > 0 && int(Workers.size()) < ClipThreadsCount())) {
 		_threadIndex = Workers.size();
 		Workers.push_back(std::make_unique<Worker>());
-	} else {
-		_threadIndex = base::RandomIndex(Workers.size());
-		auto loadLevel = 0x7FFFFFFF;
-		for (int i = 0, l = int(Workers.size()); i < l; ++i) {
-			const auto level = Workers[i]->manager.loadLevel();
-			if (level < loadLevel) {
-				_threadIndex = i;
-				loadLevel = level;
-			}
-		}
 	}
 	Workers[_threadIndex]->manager.append(this, location, data);
 }
@@ -894,25 +915,11 @@ void Manager::process() {
 		checkAllReaders = (_readers.size() > _readerPointers.size());
 	}
 
+	auto due = std::vector<std::pair<crl::time, ReaderPrivate*>>();
 	for (auto i = _readers.begin(), e = _readers.end(); i != e;) {
 		ReaderPrivate *reader = i.key();
 		if (i.value() <= ms) {
-			ResultHandleState state = handleResult(reader, reader->process(ms), ms);
-			if (state == ResultHandleRemove) {
-				i = _readers.erase(i);
-				continue;
-			} else if (state == ResultHandleStop) {
-				_processingInThread = nullptr;
-				return;
-			}
-			ms = crl::now();
-			if (reader->_videoPausedAtMs) {
-				i.value() = ms + 86400 * 1000ULL;
-			} else if (reader->_nextFrameWhen && reader->_started) {
-				i.value() = reader->_nextFrameWhen;
-			} else {
-				i.value() = (ms + 86400 * 1000ULL);
-			}
+			due.emplace_back(i.value(), reader);
 		} else if (checkAllReaders) {
 			QMutexLocker lock(&_readerPointersMutex);
 			auto it = constUnsafeFindReaderPointer(reader);
@@ -923,10 +930,42 @@ void Manager::process() {
 				continue;
 			}
 		}
-		if (!reader->_autoPausedGif && i.value() < minms) {
+		++i;
+	}
+
+	// Process the visible readers first and the most overdue of them
+	// before others, so that a heavy clip doesn't always delay the ones
+	// that happen to be after it.
+	ranges::sort(due, ranges::less(), [](const auto &pair) {
+		return std::make_pair(pair.second->_autoPausedGif, pair.first);
+	});
+	for (const auto &[when, reader] : due) {
+		const auto i = _readers.find(reader);
+		if (!reader->_autoPausedGif && Logs::DebugEnabled()) {
+			countFrame(when, ms);
+		}
+		ResultHandleState state = handleResult(reader, reader->process(ms), ms);
+		if (state == ResultHandleRemove) {
+			_readers.erase(i);
+			continue;
+		} else if (state == ResultHandleStop) {
+			_processingInThread = nullptr;
+			return;
+		}
+		ms = crl::now();
+		if (reader->_videoPausedAtMs) {
+			i.value() = ms + 86400 * 1000ULL;
+		} else if (reader->_nextFrameWhen && reader->_started) {
+			i.value() = reader->_nextFrameWhen;
+		} else {
+			i.value() = (ms + 86400 * 1000ULL);
+		}
+	}
+
+	for (auto i = _readers.cbegin(), e = _readers.cend(); i != e; ++i) {
+		if (!i.key()->_autoPausedGif && i.value() < minms) {
 			minms = i.value();
 		}
-		++i;
 	}
 
 	ms = crl::now();
@@ -940,6 +979,30 @@ void Manager::process() {
 	_processingInThread = nullptr;
 }
 
+void Manager::countFrame(crl::time when, crl::time ms) {
+	if (!_statsStarted) {
+		_statsStarted = ms;
+	}
+	const auto late = (when > 0) ? (ms - when) : 0;
+	_statsMostLate = std::max(_statsMostLate, late);
+	++_statsFrames;
+	if (late >= kFrameLateThreshold) {
+		++_statsLateFrames;
+	}
+	if (ms - _statsStarted >= kFrameStatsPeriod) {
+		DEBUG_LOG(("Clip Stats: %1 frames in %2ms, %3 late by %4ms or more, "
+			"most by %5ms."
+			).arg(_statsFrames
+			).arg(ms - _statsStarted
+			).arg(_statsLateFrames
+			).arg(kFrameLateThreshold
+			).arg(_statsMostLate));
+		_statsStarted = ms;
+		_statsMostLate = 0;
+		_statsFrames = _statsLateFrames = 0;
+	}
+}
+
 void Manager::finish() {
 	_timer.stop();
 	clear();
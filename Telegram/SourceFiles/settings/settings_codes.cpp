@@ -11,6 +11,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "mainwidget.h"
 #include "mainwindow.h"
 #include "data/data_session.h"
+#include "data/data_histories.h"
 #include "data/data_cloud_themes.h"
 #include "history/history_item_components.h"
 #include "main/main_session.h"
@@ -168,6 +169,14 @@ auto GenerateCodes() {
 		Core::Application::RegisterUrlScheme();
 		Ui::Toast::Show("Forced custom scheme register.");
 	});
+	codes.emplace(u"historystats"_q, [](SessionController *window) {
+		if (window) {
+			const auto &histories = window->session().data().histories();
+			Ui::Toast::Show(u"Resident messages: %1, views: %2."_q
+				.arg(histories.residentItemsCount())
+				.arg(histories.residentViewsCount()));
+		}
+	});
 	codes.emplace(u"numberbuttons"_q, [](SessionController *window) {
 		using namespace base::options;
 		auto &option = lookup<bool>(kOptionFastButtonsMode);
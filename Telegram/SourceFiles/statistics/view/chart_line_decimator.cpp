@@ -0,0 +1,63 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "statistics/view/chart_line_decimator.h"
+
+#include <cmath>
+
+namespace Statistic {
+
+ChartLineDecimator::ChartLineDecimator(not_null<QPolygonF*> points)
+: _points(points) {
+}
+
+void ChartLineDecimator::add(QPointF point) {
+	const auto column = int(std::floor(point.x()));
+	if (!_hasColumn || column != _column) {
+		flush();
+		_hasColumn = true;
+		_column = column;
+		_first = _min = _max = _last = point;
+		_minIsFirst = true;
+		return;
+	}
+	if (point.y() < _min.y()) {
+		_min = point;
+		_minIsFirst = false;
+	} else if (point.y() > _max.y()) {
+		_max = point;
+		_minIsFirst = true;
+	}
+	_last = point;
+}
+
+void ChartLineDecimator::finish() {
+	flush();
+	_hasColumn = false;
+}
+
+void ChartLineDecimator::flush() {
+	if (!_hasColumn) {
+		return;
+	}
+	// The extreme that was updated last comes later in x order.
+	const auto &[a, b] = _minIsFirst
+		? std::pair{ _min, _max }
+		: std::pair{ _max, _min };
+	*_points << _first;
+	if (a != _first) {
+		*_points << a;
+	}
+	if (b != _first && b != a) {
+		*_points << b;
+	}
+	if (_last != _first && _last != a && _last != b) {
+		*_points << _last;
+	}
+}
+
+} // namespace Statistic
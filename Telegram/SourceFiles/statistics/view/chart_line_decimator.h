@@ -0,0 +1,40 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#pragma once
+
+#include "base/basic_types.h"
+
+#include <QtGui/QPolygonF>
+
+namespace Statistic {
+
+// Keeps at most the first, lowest, highest and last points of each pixel
+// column, in x order, so long ranges draw roughly as many points as there
+// are pixels without changing the shape of the polyline.
+class ChartLineDecimator final {
+public:
+	explicit ChartLineDecimator(not_null<QPolygonF*> points);
+
+	void add(QPointF point);
+	void finish();
+
+private:
+	void flush();
+
+	const not_null<QPolygonF*> _points;
+	int _column = 0;
+	bool _hasColumn = false;
+	bool _minIsFirst = true;
+	QPointF _first;
+	QPointF _min;
+	QPointF _max;
+	QPointF _last;
+
+};
+
+} // namespace Statistic
@@ -10,6 +10,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "data/data_statistics_chart.h"
 #include "statistics/chart_lines_filter_controller.h"
 #include "statistics/statistics_common.h"
+#include "statistics/view/chart_line_decimator.h"
 #include "ui/effects/animation_value_f.h"
 #include "ui/painter.h"
 #include "styles/style_boxes.h"
@@ -35,6 +36,13 @@ void PaintChartLine(
 
 	const auto ratio = ratios.ratio(line.id);
 
+	// Long ranges have many points in each pixel column.
+	const auto decimate = (localEnd - localStart) > c.rect.width() * 4;
+	auto decimator = ChartLineDecimator(&chartPoints);
+
+	chartPoints.reserve(decimate
+		? (c.rect.width() * 4 + 4)
+		: (localEnd - localStart + 1));
 	for (auto i = localStart; i <= localEnd; i++) {
 		if (line.y[i] < 0) {
 			continue;
@@ -45,8 +53,14 @@ void PaintChartLine(
 		const auto yPercentage = (line.y[i] * ratio - c.heightLimits.min)
 			/ float64(c.heightLimits.max - c.heightLimits.min);
 		const auto yPoint = (1. - yPercentage) * c.rect.height();
-		chartPoints << QPointF(xPoint, yPoint);
+		const auto point = QPointF(xPoint, yPoint);
+		if (decimate) {
+			decimator.add(point);
+		} else {
+			chartPoints << point;
+		}
 	}
+	decimator.finish();
 	p.setPen(QPen(
 		line.color,
 		c.footer ? st::lineWidth : st::statisticsChartLineWidth));
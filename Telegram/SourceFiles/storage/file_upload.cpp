@@ -26,9 +26,12 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 namespace Storage {
 namespace {
 
-// max 1mb uploaded at the same time in each session
+// max 1mb uploaded at the same time in each session initially
 constexpr auto kMaxUploadPerSession = 1024 * 1024;
 
+// up to 4mb uploaded at the same time if requests stay fast
+constexpr auto kMaxUploadPerSessionLimit = 4 * 1024 * 1024;
+
 constexpr auto kDocumentMaxPartsCountDefault = 4000;
 
 // 32kb for tiny document ( < 1mb )
@@ -46,6 +49,10 @@ constexpr auto kDocumentUploadPartSize3 = 256 * 1024;
 // 512kb for large document ( <= 1500mb )
 constexpr auto kDocumentUploadPartSize4 = 512 * 1024;
 
+// Big documents use larger parts if at the measured upload speed
+// such part is sent in about 250ms.
+constexpr auto kUploadPartPreferredDuration = crl::time(250);
+
 // One part each 200ms, if not uploaded faster.
 constexpr auto kUploadRequestInterval = crl::time(200);
 
@@ -74,6 +81,7 @@ struct Uploader::Entry {
 
 	void setDocSize(int64 size);
 	bool setPartSize(int partSize);
+	void adjustDocPartSize(int64 bytesPerSecond);
 
 	// const, but non-const for the move-assignment in the
 	FullMsgId itemId;
@@ -151,8 +159,35 @@ bool Uploader::Entry::setPartSize(int partSize) {
 	return (docPartsCount <= kDocumentMaxPartsCountDefault);
 }
 
+void Uploader::Entry::adjustDocPartSize(int64 bytesPerSecond) {
+	Expects(!docPartsSent);
+
+	if (docSize <= kUseBigFilesFrom || bytesPerSecond <= 0) {
+		return;
+	}
+	// setDocSize() chose the smallest part size within the parts limit,
+	// any larger one from the same list is allowed as well.
+	const auto preferred = bytesPerSecond
+		* kUploadPartPreferredDuration
+		/ crl::time(1000);
+	for (const auto partSize : {
+		kDocumentUploadPartSize4,
+		kDocumentUploadPartSize3,
+		kDocumentUploadPartSize2,
+		kDocumentUploadPartSize1,
+	}) {
+		if (partSize <= docPartSize) {
+			return;
+		} else if (partSize <= preferred) {
+			setPartSize(partSize);
+			return;
+		}
+	}
+}
+
 Uploader::Uploader(not_null<ApiWrap*> api)
 : _api(api)
+, _maxUploadPerSession(kMaxUploadPerSession)
 , _nextTimer([=] { maybeSend(); })
 , _stopSessionsTimer([=] { stopSessions(); }) {
 	const auto session = &_api->session();
@@ -407,6 +442,8 @@ void Uploader::stopSessions() {
 		}
 		_sentPerDcIndex.clear();
 		_dcIndicesWithFastRequests.clear();
+		_latestFinishedPerDcIndex.clear();
+		_maxUploadPerSession = kMaxUploadPerSession;
 	}
 }
 
@@ -551,9 +588,12 @@ auto Uploader::sendPendingPart(not_null<Entry*> entry, uchar dcIndex)
 auto Uploader::sendDocPart(not_null<Entry*> entry, uchar dcIndex)
 -> SendResult {
 	const auto itemId = entry->itemId;
+	if (!entry->docPartsSent) {
+		entry->adjustDocPartSize(_bytesPerSecond);
+	}
 	const auto alreadySent = _sentPerDcIndex[dcIndex];
 	const auto willProbablyBeSent = entry->docPartSize;
-	if (alreadySent + willProbablyBeSent > kMaxUploadPerSession) {
+	if (alreadySent + willProbablyBeSent > _maxUploadPerSession) {
 		return SendResult::DcIndexFull;
 	}
 
@@ -599,7 +639,7 @@ auto Uploader::sendSlicedPart(not_null<Entry*> entry, uchar dcIndex)
 	const auto itemId = entry->itemId;
 	const auto alreadySent = _sentPerDcIndex[dcIndex];
 	const auto willBeSent = entry->parts->at(entry->partsSent).size();
-	if (alreadySent + willBeSent >= kMaxUploadPerSession) {
+	if (alreadySent + willBeSent >= _maxUploadPerSession) {
 		return SendResult::DcIndexFull;
 	}
 
@@ -744,9 +784,25 @@ void Uploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
 	const auto fast = (duration < kFastRequestThreshold);
 	const auto slowish = !fast;
 	const auto slow = (duration >= kSlowRequestThreshold);
+	auto &latestFinished = _latestFinishedPerDcIndex[request.dcIndex];
+	// Parts in one session are sent one after another, so this part
+	// was being sent only since the previous one in the session finished.
+	const auto sending = now - std::max(request.sent, latestFinished);
+	latestFinished = now;
+	if (request.docPart && sending > 0) {
+		const auto speed = int64(bytes) * crl::time(1000) / sending;
+		_bytesPerSecond = _bytesPerSecond
+			? ((_bytesPerSecond * 3 + speed) / 4)
+			: speed;
+	}
 
 	if (slowish) {
 		_dcIndicesWithFastRequests.clear();
+		if (_maxUploadPerSession > kMaxUploadPerSession) {
+			_maxUploadPerSession /= 2;
+			DEBUG_LOG(("Uploader: Slow-ish request, window %1."
+				).arg(_maxUploadPerSession));
+		}
 		if (slow) {
 			const auto elapsed = (now - _latestDcIndexRemoved);
 			const auto remove = (elapsed >= kWaitForNormalizeTimeout);
@@ -767,6 +823,14 @@ void Uploader::partLoaded(const MTPBool &result, mtpRequestId requestId) {
 				).arg(request.dcIndex
 				).arg(_sentPerDcIndex.size()));
 		}
+		// All sessions are added and still fast, allow more bytes in flight.
+		if (int(_sentPerDcIndex.size()) == kMaxSessionsCount
+			&& (request.queued + bytes) * 2 >= _maxUploadPerSession
+			&& _maxUploadPerSession < kMaxUploadPerSessionLimit) {
+			_maxUploadPerSession *= 2;
+			DEBUG_LOG(("Uploader: Fast request, window %1."
+				).arg(_maxUploadPerSession));
+		}
 	}
 
 	if (request.docPart) {
@@ -830,6 +894,7 @@ void Uploader::removeDcIndex() {
 	Assert(_sentPerDcIndex.back() == 0);
 	_sentPerDcIndex.pop_back();
 	_dcIndicesWithFastRequests.remove(dcIndex);
+	_latestFinishedPerDcIndex.remove(dcIndex);
 	_api->instance().stopSession(MTP::uploadDcId(dcIndex));
 	DEBUG_LOG(("Uploader: Removed dc index %1.").arg(dcIndex));
 }
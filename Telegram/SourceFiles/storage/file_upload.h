@@ -162,6 +162,11 @@ private:
 
 	base::flat_map<mtpRequestId, Request> _requests;
 	std::vector<int> _sentPerDcIndex;
+	int _maxUploadPerSession = 0;
+	int64 _bytesPerSecond = 0;
+
+	// When the latest request finished in each session.
+	base::flat_map<uchar, crl::time> _latestFinishedPerDcIndex;
 
 	// Fast requests since the latest dc index addition.
 	base::flat_set<uchar> _dcIndicesWithFastRequests;
@@ -11,6 +11,7 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "storage/storage_account.h"
 #include "storage/details/storage_file_utilities.h"
 #include "storage/details/storage_settings_scheme.h"
+#include "storage/cache/storage_cache_database.h"
 #include "data/data_session.h"
 #include "data/data_document.h"
 #include "data/data_document_media.h"
@@ -834,6 +835,17 @@ public:
 			if (!_waveform.isEmpty()) {
 				voice->waveform = _waveform;
 				voice->wavemax = _wavemax;
+				// Tagged as a voice message on purpose: the waveform is
+				// counted from the voice file itself, so clearing voice
+				// messages drops both and it is counted again on download.
+				_doc->owner().cache().putIfEmpty(
+					_doc->waveformCacheKey(),
+					Storage::Cache::Database::TaggedValue(
+						QByteArray(
+							reinterpret_cast<const char*>(
+								_waveform.constData()),
+							_waveform.size()),
+						Data::kVoiceMessageCacheTag));
 			}
 			if (voice->waveform.isEmpty()) {
 				voice->waveform.resize(1);
@@ -861,7 +873,9 @@ protected:
 
 };
 
-void countVoiceWaveform(not_null<Data::DocumentMedia*> media) {
+namespace {
+
+void CountVoiceWaveformNow(not_null<Data::DocumentMedia*> media) {
 	const auto document = media->owner();
 	if (const auto voice = document->voice()) {
 		if (_localLoader) {
@@ -874,6 +888,41 @@ void countVoiceWaveform(not_null<Data::DocumentMedia*> media) {
 	}
 }
 
+} // namespace
+
+void countVoiceWaveform(not_null<Data::DocumentMedia*> media) {
+	const auto document = media->owner();
+	const auto voice = document->voice();
+	if (!voice || !_localLoader) {
+		return;
+	}
+	voice->waveform.resize(1);
+	voice->waveform[0] = -1; // counting
+
+	// Try the waveform counted earlier before decoding the whole file.
+	const auto guard = base::make_weak(&document->session());
+	const auto got = [=](QByteArray value) {
+		crl::on_main(guard, [=] {
+			const auto voice = document->voice();
+			if (!voice
+				|| voice->waveform.size() != 1
+				|| voice->waveform[0] != -1) {
+				return;
+			} else if (!value.isEmpty()) {
+				voice->waveform = VoiceWaveform(value.size());
+				memcpy(voice->waveform.data(), value.data(), value.size());
+				voice->wavemax = *ranges::max_element(voice->waveform);
+				document->owner().requestDocumentViewRepaint(document);
+			} else if (const auto active = document->activeMediaView()) {
+				CountVoiceWaveformNow(active.get());
+			} else {
+				voice->waveform.clear();
+			}
+		});
+	};
+	document->owner().cache().get(document->waveformCacheKey(), got);
+}
+
 void cancelTask(TaskId id) {
 	if (_localLoader) {
 		_localLoader->cancelTask(id);
@@ -46,6 +46,9 @@ using namespace details;
 using Database = Cache::Database;
 
 constexpr auto kDelayedWriteTimeout = crl::time(1000);
+
+// Locations are rewritten as a whole, so batch all changes in a window.
+constexpr auto kWriteLocationsTimeout = 5 * crl::time(1000);
 constexpr auto kWriteSearchSuggestionsDelay = 5 * crl::time(1000);
 constexpr auto kMaxSavedPlaybackPositions = 256;
 
@@ -184,6 +187,9 @@ Account::Account(not_null<Main::Account*> owner, const QString &dataName)
 Account::~Account() {
 	Expects(!_writeSearchSuggestionsTimer.isActive());
 
+	if (_localKey && _locationsChanged) {
+		writeLocations();
+	}
 	if (_localKey && _mapChanged) {
 		writeMap();
 	}
@@ -902,16 +908,11 @@ void Account::writeLocations() {
 	}
 }
 
-void Account::writeLocationsQueued() {
-	_locationsChanged = true;
-	crl::on_main(_owner, [=] {
-		writeLocations();
-	});
-}
-
 void Account::writeLocationsDelayed() {
 	_locationsChanged = true;
-	_writeLocationsTimer.callOnce(kDelayedWriteTimeout);
+	if (!_writeLocationsTimer.isActive()) {
+		_writeLocationsTimer.callOnce(kWriteLocationsTimeout);
+	}
 }
 
 void Account::readLocations() {
@@ -1745,7 +1746,7 @@ void Account::writeFileLocation(MediaKey location, const Core::FileLocation &loc
 			if (i.value().second == local) {
 				if (i.value().first != location) {
 					_fileLocationAliases.insert(location, i.value().first);
-					writeLocationsQueued();
+					writeLocationsDelayed();
 				}
 				return;
 			}
@@ -1769,7 +1770,7 @@ void Account::writeFileLocation(MediaKey location, const Core::FileLocation &loc
 		}
 	}
 	_fileLocations.insert(location, local);
-	writeLocationsQueued();
+	writeLocationsDelayed();
 }
 
 void Account::removeFileLocation(MediaKey location) {
@@ -1780,7 +1781,7 @@ void Account::removeFileLocation(MediaKey location) {
 	while (i != _fileLocations.end() && (i.key() == location)) {
 		i = _fileLocations.erase(i);
 	}
-	writeLocationsQueued();
+	writeLocationsDelayed();
 }
 
 Core::FileLocation Account::readFileLocation(MediaKey location) {
@@ -235,7 +235,6 @@ private:
 
 	void readLocations();
 	void writeLocations();
-	void writeLocationsQueued();
 	void writeLocationsDelayed();
 
 	std::unique_ptr<Main::SessionSettings> readSessionSettings();
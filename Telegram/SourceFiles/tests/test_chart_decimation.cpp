@@ -0,0 +1,174 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "tests/test_main.h"
+
+#include "statistics/view/chart_line_decimator.h"
+
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
+
+#include <cmath>
+#include <random>
+
+namespace Test {
+namespace {
+
+constexpr auto kPoints = 100'000;
+constexpr auto kWidth = 800;
+constexpr auto kHeight = 400;
+constexpr auto kBenchmarkRounds = 5;
+
+[[nodiscard]] QPolygonF GenerateSeries() {
+	auto generator = std::mt19937(7);
+	auto noise = std::normal_distribution<double>(0., 20.);
+	auto result = QPolygonF();
+	result.reserve(kPoints);
+	for (auto i = 0; i != kPoints; ++i) {
+		const auto x = kWidth * (i / double(kPoints));
+		const auto y = kHeight / 2.
+			+ std::sin(i / 500.) * kHeight / 3.
+			+ noise(generator);
+		result << QPointF(x, std::clamp(y, 0., double(kHeight)));
+	}
+	return result;
+}
+
+[[nodiscard]] QPolygonF Decimate(const QPolygonF &series) {
+	auto result = QPolygonF();
+	result.reserve(kWidth * 4 + 4);
+	auto decimator = Statistic::ChartLineDecimator(&result);
+	for (const auto &point : series) {
+		decimator.add(point);
+	}
+	decimator.finish();
+	return result;
+}
+
+// Checks every column against a brute force pass over the input.
+[[nodiscard]] QStringList Verify(
+		const QPolygonF &series,
+		const QPolygonF &decimated) {
+	auto errors = QStringList();
+	const auto column = [](const QPointF &point) {
+		return int(std::floor(point.x()));
+	};
+	const auto contains = [](const QPolygonF &points, QPointF point) {
+		return points.indexOf(point) >= 0;
+	};
+	for (auto i = 1; i < decimated.size(); ++i) {
+		if (decimated[i].x() < decimated[i - 1].x()) {
+			errors.push_back(u"Point %1 goes back in x."_q.arg(i));
+		}
+	}
+	auto from = 0;
+	auto to = 0;
+	while (from != series.size()) {
+		const auto current = column(series[from]);
+		auto part = QPolygonF();
+		for (auto i = to; i != decimated.size(); ++i) {
+			if (column(decimated[i]) != current) {
+				break;
+			}
+			part << decimated[i];
+		}
+		to += part.size();
+
+		auto till = from;
+		auto lowest = series[from];
+		auto highest = series[from];
+		while (till != series.size() && column(series[till]) == current) {
+			if (series[till].y() < lowest.y()) {
+				lowest = series[till];
+			} else if (series[till].y() > highest.y()) {
+				highest = series[till];
+			}
+			++till;
+		}
+		const auto first = series[from];
+		const auto last = series[till - 1];
+		if (part.size() > 4) {
+			errors.push_back(u"Column %1 has %2 points."_q
+				.arg(current)
+				.arg(part.size()));
+		}
+		if (part.isEmpty() || part.front() != first) {
+			errors.push_back(u"Column %1 lost its first point."_q
+				.arg(current));
+		}
+		if (part.isEmpty() || part.back() != last) {
+			errors.push_back(u"Column %1 lost its last point."_q
+				.arg(current));
+		}
+		if (!contains(part, lowest) || !contains(part, highest)) {
+			errors.push_back(u"Column %1 lost an extreme point."_q
+				.arg(current));
+		}
+		from = till;
+	}
+	if (to != decimated.size()) {
+		errors.push_back(u"Extra points after the last column."_q);
+	}
+	return errors;
+}
+
+template <typename Method>
+[[nodiscard]] crl::time Measure(Method method) {
+	auto best = crl::time(-1);
+	for (auto round = 0; round != kBenchmarkRounds; ++round) {
+		const auto started = crl::now();
+		method();
+		const auto duration = crl::now() - started;
+		if (best < 0 || duration < best) {
+			best = duration;
+		}
+	}
+	return best;
+}
+
+[[nodiscard]] crl::time MeasurePaint(const QPolygonF &points) {
+	auto image = QImage(kWidth, kHeight, QImage::Format_ARGB32_Premultiplied);
+	return Measure([&] {
+		image.fill(Qt::transparent);
+		auto p = QPainter(&image);
+		p.setRenderHint(QPainter::Antialiasing);
+		p.setPen(QPen(QColor(0, 128, 255), 2.));
+		p.drawPolyline(points);
+	});
+}
+
+} // namespace
+
+QString name() {
+	return u"chart_decimation"_q;
+}
+
+void test(not_null<Ui::RpWindow*> window, not_null<Ui::RpWidget*> body) {
+	const auto series = GenerateSeries();
+	const auto decimated = Decimate(series);
+
+	auto lines = Verify(series, decimated).mid(0, 10);
+	if (lines.isEmpty()) {
+		lines.push_back(u"Every column keeps first, min, max, last in x order."_q);
+	}
+	lines.push_back(u"%1 points decimated to %2 for %3 px."_q
+		.arg(series.size())
+		.arg(decimated.size())
+		.arg(kWidth));
+
+	const auto decimation = Measure([&] {
+		[[maybe_unused]] const auto result = Decimate(series);
+	});
+	lines.push_back(u"Decimation: %1 ms."_q.arg(decimation));
+	lines.push_back(u"Painting: all points %1 ms, decimated %2 ms."_q
+		.arg(MeasurePaint(series))
+		.arg(MeasurePaint(decimated)));
+
+	showReport(body, lines);
+}
+
+} // namespace Test
@@ -0,0 +1,222 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "tests/test_main.h"
+
+#include "export/output/export_output_html_serialize.h"
+
+#include <random>
+
+namespace Test {
+namespace {
+
+constexpr auto kRandomChecks = 100'000;
+constexpr auto kBenchmarkStrings = 200'000;
+constexpr auto kBenchmarkRounds = 5;
+
+// The implementation before the exactly sized pass, kept for comparing.
+QByteArray OldSerializeString(const QByteArray &value) {
+	const auto size = value.size();
+	const auto begin = value.data();
+	const auto end = begin + size;
+
+	auto result = QByteArray();
+	result.reserve(size * 6);
+	for (auto p = begin; p != end; ++p) {
+		const auto ch = *p;
+		if (ch == '\n') {
+			result.append("<br>", 4);
+		} else if (ch == '"') {
+			result.append("&quot;", 6);
+		} else if (ch == '&') {
+			result.append("&amp;", 5);
+		} else if (ch == '\'') {
+			result.append("&apos;", 6);
+		} else if (ch == '<') {
+			result.append("&lt;", 4);
+		} else if (ch == '>') {
+			result.append("&gt;", 4);
+		} else if (ch >= 0 && ch < 32) {
+			result.append("&#x", 3).append('0' + (ch >> 4));
+			const auto left = (ch & 0x0F);
+			if (left >= 10) {
+				result.append('A' + (left - 10));
+			} else {
+				result.append('0' + left);
+			}
+			result.append(';');
+		} else if (ch == char(0xE2)
+			&& (p + 2 < end)
+			&& *(p + 1) == char(0x80)) {
+			if (*(p + 2) == char(0xA8)) { // Line separator.
+				result.append("<br>", 4);
+			} else if (*(p + 2) == char(0xA9)) { // Paragraph separator.
+				result.append("<br>", 4);
+			} else {
+				result.append(ch);
+			}
+		} else {
+			result.append(ch);
+		}
+	}
+	return result;
+}
+
+QByteArray OldSerializeList(const std::vector<QByteArray> &values) {
+	const auto count = values.size();
+	if (count == 1) {
+		return values[0];
+	} else if (count > 1) {
+		auto result = values[0];
+		for (auto i = 1; i != count - 1; ++i) {
+			result += ", " + values[i];
+		}
+		return result + " and " + values[count - 1];
+	}
+	return QByteArray();
+}
+
+[[nodiscard]] std::vector<QByteArray> EdgeStrings() {
+	auto result = std::vector<QByteArray>{
+		QByteArray(),
+		"plain text without anything special",
+		"<b>\"quoted\" & 'apostrophe'</b>\nnext line",
+		"\xE2\x80\xA8", // Line separator.
+		"\xE2\x80\xA9", // Paragraph separator.
+		"a\xE2\x80\xA8" "b\xE2\x80\xA9" "c",
+		"\xE2\x80\xAA", // Left-to-right embedding, kept as is.
+		"trailing \xE2",
+		"trailing \xE2\x80",
+		"\xE2",
+		"\xE2\x80",
+		"\xE2\xE2\x80\xA8",
+		"\xF0\x9F\x91\x8D emoji",
+	};
+	auto controls = QByteArray();
+	for (auto ch = 0; ch != 32; ++ch) {
+		controls.append(char(ch));
+		result.push_back(QByteArray(1, char(ch)));
+	}
+	result.push_back(controls);
+	result.push_back(QByteArray("\x7F\x80\xFF", 3));
+	return result;
+}
+
+[[nodiscard]] QByteArray RandomString(std::mt19937 &generator) {
+	// Bias towards the bytes that need escaping or start a separator.
+	static const auto special = QByteArray(
+		"\n\"&'<>\x01\x1F\xE2\x80\xA8\xA9");
+	auto length = std::uniform_int_distribution<int>(0, 16);
+	auto kind = std::uniform_int_distribution<int>(0, 3);
+	auto any = std::uniform_int_distribution<int>(0, 255);
+	auto index = std::uniform_int_distribution<int>(0, special.size() - 1);
+	auto result = QByteArray();
+	for (auto i = length(generator); i != 0; --i) {
+		result.append(kind(generator)
+			? special[index(generator)]
+			: char(any(generator)));
+	}
+	return result;
+}
+
+[[nodiscard]] std::vector<QByteArray> BenchmarkStrings() {
+	auto generator = std::mt19937(2024);
+	auto escaped = std::uniform_int_distribution<int>(0, 9);
+	auto result = std::vector<QByteArray>();
+	result.reserve(kBenchmarkStrings);
+	for (auto i = 0; i != kBenchmarkStrings; ++i) {
+		// Most exported values are plain message text and names.
+		result.push_back(escaped(generator)
+			? QByteArray("Lorem ipsum dolor sit amet, consectetur adipiscing "
+				"elit, sed do eiusmod tempor incididunt ut labore.")
+			: QByteArray("He said \"<hello>\" & left.\nSee you later."));
+	}
+	return result;
+}
+
+template <typename Value, typename Method>
+[[nodiscard]] crl::time Measure(
+		const std::vector<Value> &values,
+		Method method) {
+	auto best = crl::time(-1);
+	for (auto round = 0; round != kBenchmarkRounds; ++round) {
+		const auto started = crl::now();
+		for (const auto &value : values) {
+			[[maybe_unused]] const auto result = method(value);
+		}
+		const auto duration = crl::now() - started;
+		if (best < 0 || duration < best) {
+			best = duration;
+		}
+	}
+	return best;
+}
+
+} // namespace
+
+QString name() {
+	return u"export_html"_q;
+}
+
+void test(not_null<Ui::RpWindow*> window, not_null<Ui::RpWidget*> body) {
+	using namespace Export::Output;
+
+	auto lines = QStringList();
+	auto failed = 0;
+	const auto check = [&](const QByteArray &value) {
+		if (SerializeString(value) != OldSerializeString(value)) {
+			if (++failed <= 10) {
+				lines.push_back(u"FAIL SerializeString: "_q
+					+ QString::fromLatin1(value.toHex(' ')));
+			}
+		}
+	};
+	const auto edge = EdgeStrings();
+	for (const auto &value : edge) {
+		check(value);
+	}
+	auto generator = std::mt19937(1);
+	for (auto i = 0; i != kRandomChecks; ++i) {
+		check(RandomString(generator));
+	}
+	for (auto count = 0; count != 5; ++count) {
+		const auto values = std::vector<QByteArray>(
+			begin(edge),
+			begin(edge) + count);
+		if (SerializeList(values) != OldSerializeList(values)) {
+			++failed;
+			lines.push_back(u"FAIL SerializeList: %1 values"_q.arg(count));
+		}
+	}
+	lines.push_back(failed
+		? u"%1 mismatches."_q.arg(failed)
+		: u"SerializeString and SerializeList match the old code."_q);
+
+	const auto strings = BenchmarkStrings();
+	const auto oldString = Measure(strings, OldSerializeString);
+	const auto newString = Measure(strings, SerializeString);
+	lines.push_back(u"SerializeString, %1 strings: old %2 ms, new %3 ms."_q
+		.arg(strings.size())
+		.arg(oldString)
+		.arg(newString));
+
+	auto lists = std::vector<std::vector<QByteArray>>();
+	for (auto i = 0; i + 4 <= int(strings.size()); i += 4) {
+		const auto from = strings.begin() + i;
+		lists.push_back(std::vector<QByteArray>(from, from + 4));
+	}
+	const auto oldList = Measure(lists, OldSerializeList);
+	const auto newList = Measure(lists, SerializeList);
+	lines.push_back(u"SerializeList, %1 lists: old %2 ms, new %3 ms."_q
+		.arg(lists.size())
+		.arg(oldList)
+		.arg(newList));
+
+	showReport(body, lines);
+}
+
+} // namespace Test
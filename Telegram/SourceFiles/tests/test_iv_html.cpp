@@ -0,0 +1,187 @@
+/*
+This file is part of Telegram Desktop,
+the official desktop application for the Telegram messaging service.
+
+For license and copyright information please follow this link:
+https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
+*/
+#include "tests/test_main.h"
+
+#include "iv/iv_prepare_html.h"
+
+#include <random>
+
+namespace Test {
+namespace {
+
+constexpr auto kParagraphs = 20'000;
+constexpr auto kBenchmarkRounds = 5;
+
+// The implementations before the single buffer pass, kept for comparing.
+QByteArray OldEscape(QByteArray value) {
+	auto result = QByteArray();
+	result.reserve(value.size());
+	for (const auto &ch : value) {
+		switch (ch) {
+		case '&': result.append("&amp;"); break;
+		case '<': result.append("&lt;"); break;
+		case '>': result.append("&gt;"); break;
+		case '"': result.append("&quot;"); break;
+		case '\'': result.append("&apos;"); break;
+		default: result.append(ch); break;
+		}
+	}
+	return result;
+}
+
+QByteArray OldTag(
+		const QByteArray &name,
+		const Iv::Attributes &attributes,
+		const QByteArray &body) {
+	auto list = QByteArrayList();
+	list.reserve(attributes.size());
+	for (auto &[key, value] : attributes) {
+		list.push_back(' ' + key + (value ? "=\"" + *value + "\"" : ""));
+	}
+	const auto serialized = list.join(QByteArray());
+	return (Iv::IsVoidElement(name) && body.isEmpty())
+		? ('<' + name + serialized + " />")
+		: ('<' + name + serialized + '>' + body + "</" + name + '>');
+}
+
+struct Paragraph {
+	QByteArray text;
+	QByteArray link;
+	QByteArray linkText;
+	QByteArray image;
+};
+
+// Text, links and images like in the blocks of a long article page.
+[[nodiscard]] std::vector<Paragraph> GeneratePage() {
+	auto generator = std::mt19937(11);
+	auto kind = std::uniform_int_distribution<int>(0, 9);
+	auto result = std::vector<Paragraph>();
+	result.reserve(kParagraphs);
+	for (auto i = 0; i != kParagraphs; ++i) {
+		const auto special = !kind(generator);
+		result.push_back({
+			.text = (special
+				? "Prices went <up> by 5% & \"analysts\" don't agree."_q
+				: ("The committee met on Tuesday to discuss the proposal, "
+					"which was later published in full on the website."_q)),
+			.link = "https://example.com/articles/"_q + QByteArray::number(i),
+			.linkText = "Read more"_q,
+			.image = (kind(generator) ? QByteArray() : "photo"_q),
+		});
+	}
+	return result;
+}
+
+template <typename EscapeMethod, typename TagMethod>
+[[nodiscard]] QByteArray Serialize(
+		const std::vector<Paragraph> &page,
+		EscapeMethod escape,
+		TagMethod tag) {
+	auto result = QByteArray();
+	for (const auto &paragraph : page) {
+		auto body = escape(paragraph.text);
+		body.append(' ').append(tag("a"_q, {
+			{ "href"_q, escape(paragraph.link) },
+			{ "target"_q, "_blank"_q },
+		}, escape(paragraph.linkText)));
+		result.append(tag("p"_q, {}, body));
+		if (!paragraph.image.isEmpty()) {
+			result.append(tag("figure"_q, {}, tag("img"_q, {
+				{ "src"_q, escape(paragraph.image) },
+				{ "loading"_q, std::nullopt },
+			}, {})));
+		}
+	}
+	return result;
+}
+
+template <typename Method>
+[[nodiscard]] crl::time Measure(Method method) {
+	auto best = crl::time(-1);
+	for (auto round = 0; round != kBenchmarkRounds; ++round) {
+		const auto started = crl::now();
+		method();
+		const auto duration = crl::now() - started;
+		if (best < 0 || duration < best) {
+			best = duration;
+		}
+	}
+	return best;
+}
+
+} // namespace
+
+QString name() {
+	return u"iv_html"_q;
+}
+
+void test(not_null<Ui::RpWindow*> window, not_null<Ui::RpWidget*> body) {
+	auto lines = QStringList();
+
+	const auto escapes = std::vector<QByteArray>{
+		QByteArray(),
+		"plain"_q,
+		"&<>\"'"_q,
+		"a & b < c > d \"e\" 'f'"_q,
+		"\xF0\x9F\x91\x8D & \xE2\x80\xA8"_q,
+	};
+	for (const auto &value : escapes) {
+		if (Iv::Escape(value) != OldEscape(value)) {
+			lines.push_back(u"FAIL Escape: "_q + QString::fromUtf8(value));
+		}
+	}
+	const auto tags = std::vector<std::pair<QByteArray, Iv::Attributes>>{
+		{ "p"_q, {} },
+		{ "br"_q, {} },
+		{ "img"_q, {
+			{ "src"_q, "a.jpg"_q },
+			{ "loading"_q, std::nullopt },
+		} },
+		{ "a"_q, { { "href"_q, QByteArray() } } },
+	};
+	for (const auto &[tagName, attributes] : tags) {
+		for (const auto &content : { QByteArray(), "text"_q }) {
+			const auto now = Iv::Tag(tagName, attributes, content);
+			if (now != OldTag(tagName, attributes, content)) {
+				lines.push_back(u"FAIL Tag: "_q + QString::fromUtf8(now));
+			}
+		}
+	}
+
+	const auto page = GeneratePage();
+	const auto was = Serialize(page, OldEscape, OldTag);
+	const auto now = Serialize(page, Iv::Escape, Iv::Tag);
+	if (was != now) {
+		lines.push_back(u"FAIL: the serialized pages differ."_q);
+	}
+	if (lines.isEmpty()) {
+		lines.push_back(u"Escape and Tag match the old code."_q);
+	}
+
+	const auto oldTime = Measure([&] {
+		[[maybe_unused]] const auto result = Serialize(
+			page,
+			OldEscape,
+			OldTag);
+	});
+	const auto newTime = Measure([&] {
+		[[maybe_unused]] const auto result = Serialize(
+			page,
+			Iv::Escape,
+			Iv::Tag);
+	});
+	lines.push_back(u"%1 paragraphs, %2 KB: old %3 ms, new %4 ms."_q
+		.arg(page.size())
+		.arg(now.size() / 1024)
+		.arg(oldTime)
+		.arg(newTime));
+
+	showReport(body, lines);
+}
+
+} // namespace Test
@@ -126,6 +126,23 @@ rpl::producer<> App::widgetUpdateRequests() const {
 	return _widgetUpdateRequests.events();
 }
 
+void showReport(not_null<Ui::RpWidget*> widget, const QStringList &lines) {
+	widget->paintRequest() | rpl::start_with_next([=](QRect clip) {
+		auto p = QPainter(widget);
+		p.fillRect(clip, QColor(255, 255, 255));
+		p.setPen(QColor(0, 0, 0));
+
+		const auto skip = scale(20);
+		const auto line = p.fontMetrics().height();
+		auto top = skip;
+		for (const auto &text : lines) {
+			p.drawText(skip, top + p.fontMetrics().ascent(), text);
+			top += line;
+		}
+	}, widget->lifetime());
+	widget->update();
+}
+
 void BaseIntegration::enterFromEventLoop(FnMut<void()> &&method) {
 	app().customEnterFromEventLoop(std::move(method));
 }
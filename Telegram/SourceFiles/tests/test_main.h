@@ -35,6 +35,9 @@ void test(not_null<Ui::RpWindow*> window, not_null<Ui::RpWidget*> widget);
 	return style::ConvertScale(value);
 };
 
+// Tests that only compute results show them as lines of text.
+void showReport(not_null<Ui::RpWidget*> widget, const QStringList &lines);
+
 class App final : public QApplication, public QAbstractNativeEventFilter {
 public:
 	using QApplication::QApplication;
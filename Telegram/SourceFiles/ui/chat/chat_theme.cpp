@@ -20,7 +20,9 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ui/style/style_palette_colorizer.h"
 
 #include <crl/crl_async.h>
+#include <QtCore/QMutex>
 #include <QtGui/QGuiApplication>
+#include <xxhash.h>
 
 namespace Ui {
 namespace {
@@ -32,6 +34,7 @@ constexpr auto kMinimumTiledSize = 512;
 constexpr auto kMaxSize = 2960;
 constexpr auto kMaxContrastValue = 21.;
 constexpr auto kMinAcceptableContrast = 1.14;// 4.5;
+constexpr auto kCachedBackgroundsSizeLimit = 64 * 1024 * 1024;
 
 [[nodiscard]] QColor DefaultBackgroundColor() {
 	return QColor(213, 223, 233);
@@ -256,6 +259,100 @@ constexpr auto kMinAcceptableContrast = 1.14;// 4.5;
 	return Images::GenerateLinearGradient(QSize(kSize, kSize), data.colors);
 }
 
+[[nodiscard]] uint64 ComputeImageHash(const QImage &image) {
+	return image.isNull()
+		? 0
+		: XXH64(image.constBits(), image.sizeInBytes(), 0);
+}
+
+// Returns zero if the prepared images were not hashed when prepared,
+// hashing multi-megabyte images for each request costs too much.
+[[nodiscard]] uint64 ComputeCacheBackgroundKey(
+		const CacheBackgroundRequest &request) {
+	const auto &background = request.background;
+	if ((!background.prepared.isNull() && !background.preparedHash)
+		|| (!background.gradientForFill.isNull()
+			&& !background.gradientForFillHash)
+		|| (!background.giftSymbolFrame.isNull()
+			&& !background.giftSymbolFrameHash)) {
+		return 0;
+	}
+	const auto pack = [](int a, int b) {
+		return (uint64(uint32(a)) << 32) | uint64(uint32(b));
+	};
+	auto fields = std::vector<uint64>{
+		background.preparedHash,
+		background.gradientForFillHash,
+		background.giftSymbolFrameHash,
+		background.giftId,
+		pack(background.isPattern ? 1 : 0, background.tile ? 1 : 0),
+		pack(int(background.patternOpacity * 1000.), style::DevicePixelRatio()),
+		pack(request.area.width(), request.area.height()),
+		pack(ComputeRealRotation(request), request.gradientRotationAdd),
+		pack(int(request.gradientProgress * 1000.), 0),
+	};
+	for (const auto &color : background.colors) {
+		fields.push_back(color.rgba());
+	}
+	return XXH64(fields.data(), fields.size() * sizeof(uint64), 0);
+}
+
+struct SharedCachedBackground {
+	uint64 key = 0;
+	CacheBackgroundResult result;
+};
+
+// Rendered backgrounds are shared by all ChatTheme instances, so switching
+// between chats with custom themes doesn't render the same picture again.
+class SharedCachedBackgrounds final {
+public:
+	[[nodiscard]] std::optional<CacheBackgroundResult> find(uint64 key) {
+		auto lock = QMutexLocker(&_mutex);
+		const auto i = ranges::find(
+			_entries,
+			key,
+			&SharedCachedBackground::key);
+		if (i == end(_entries)) {
+			return std::nullopt;
+		}
+		std::rotate(i, i + 1, end(_entries));
+		return _entries.back().result;
+	}
+	void remember(uint64 key, const CacheBackgroundResult &result) {
+		const auto size = ComputeSize(result);
+		if (size > kCachedBackgroundsSizeLimit / 4) {
+			return;
+		}
+		auto lock = QMutexLocker(&_mutex);
+		if (ranges::contains(_entries, key, &SharedCachedBackground::key)) {
+			return;
+		}
+		_entries.push_back({ key, result });
+		_size += size;
+		while (_size > kCachedBackgroundsSizeLimit) {
+			_size -= ComputeSize(_entries.front().result);
+			_entries.erase(begin(_entries));
+		}
+	}
+
+private:
+	[[nodiscard]] static int64 ComputeSize(
+			const CacheBackgroundResult &result) {
+		return int64(result.image.sizeInBytes())
+			+ int64(result.gradient.sizeInBytes());
+	}
+
+	QMutex _mutex;
+	std::vector<SharedCachedBackground> _entries;
+	int64 _size = 0;
+
+};
+
+[[nodiscard]] SharedCachedBackgrounds &CachedBackgrounds() {
+	static auto result = SharedCachedBackgrounds();
+	return result;
+}
+
 } // namespace
 
 bool operator==(const ChatThemeBackground &a, const ChatThemeBackground &b) {
@@ -287,7 +384,23 @@ bool operator!=(
 
 CacheBackgroundResult CacheBackground(
 		const CacheBackgroundRequest &request) {
-	return CacheBackgroundByRequest(request);
+	if (request.gradientRotationAdd != 0) {
+		// Gradient rotation frames are used only once.
+		return CacheBackgroundByRequest(request);
+	}
+	const auto key = ComputeCacheBackgroundKey(request);
+	if (!key) {
+		return CacheBackgroundByRequest(request);
+	}
+	auto &cache = CachedBackgrounds();
+	if (auto cached = cache.find(key)) {
+		return std::move(*cached);
+	}
+	auto result = CacheBackgroundByRequest(request);
+	if (!result.image.isNull()) {
+		cache.remember(key, result);
+	}
+	return result;
 }
 
 CachedBackground::CachedBackground(CacheBackgroundResult &&result)
@@ -513,6 +626,7 @@ void ChatTheme::setBackground(ChatThemeBackground &&background) {
 void ChatTheme::updateBackgroundImageFrom(ChatThemeBackground &&background) {
 	_mutableBackground.key = background.key;
 	_mutableBackground.prepared = std::move(background.prepared);
+	_mutableBackground.preparedHash = background.preparedHash;
 	_mutableBackground.giftSymbols = std::move(background.giftSymbols);
 	_mutableBackground.giftId = background.giftId;
 	_mutableBackground.preparedForTiled = std::move(
@@ -536,6 +650,8 @@ void ChatTheme::setBubblesBackground(QImage image) {
 		return;
 	}
 	_bubblesBackgroundPrepared = std::move(image);
+	_bubblesBackgroundPreparedHash = ComputeImageHash(
+		_bubblesBackgroundPrepared);
 	if (_bubblesBackgroundPrepared.isNull()) {
 		_bubblesBackgroundPattern = nullptr;
 		// setBubblesBackground called only from background thread.
@@ -545,6 +661,7 @@ void ChatTheme::setBubblesBackground(QImage image) {
 	_bubblesBackground = CacheBackground({
 		.background = {
 			.prepared = _bubblesBackgroundPrepared,
+			.preparedHash = _bubblesBackgroundPreparedHash,
 		},
 		.area = (_bubblesBackground.area.isEmpty()
 			? _bubblesBackgroundPrepared.size()
@@ -763,6 +880,7 @@ auto ChatTheme::cacheBubblesRequest(QSize area) const
 	return {
 		.background = {
 			.gradientForFill = _bubblesBackgroundPrepared,
+			.gradientForFillHash = _bubblesBackgroundPreparedHash,
 		},
 		.area = area,
 	};
@@ -1241,6 +1359,9 @@ ChatThemeBackground PrepareBackgroundImage(
 	auto gradientForFill = (data.generateGradient && data.colors.size() > 1)
 		? Ui::GenerateDitheredGradient(data.colors, data.gradientRotation)
 		: QImage();
+	const auto preparedHash = ComputeImageHash(prepared);
+	const auto gradientForFillHash = ComputeImageHash(gradientForFill);
+	const auto giftSymbolFrameHash = ComputeImageHash(data.giftSymbolFrame);
 	return ChatThemeBackground{
 		.key = data.key,
 		.prepared = prepared,
@@ -1255,6 +1376,9 @@ ChatThemeBackground PrepareBackgroundImage(
 		.giftSymbols = std::move(read.giftSymbols),
 		.giftSymbolFrame = data.giftSymbolFrame,
 		.giftId = data.giftId,
+		.preparedHash = preparedHash,
+		.gradientForFillHash = gradientForFillHash,
+		.giftSymbolFrameHash = giftSymbolFrameHash,
 		.patternOpacity = data.patternOpacity,
 		.gradientRotation = data.generateGradient ? data.gradientRotation : 0,
 		.isPattern = data.isPattern,
@@ -41,6 +41,9 @@ struct ChatThemeBackground {
 	std::vector<ChatThemeGiftSymbol> giftSymbols;
 	QImage giftSymbolFrame;
 	uint64_t giftId = 0;
+	uint64 preparedHash = 0; // Zero if not computed for non-null prepared.
+	uint64 gradientForFillHash = 0;
+	uint64 giftSymbolFrameHash = 0;
 	float64 patternOpacity = 1.;
 	int gradientRotation = 0;
 	bool isPattern = false;
@@ -228,6 +231,7 @@ private:
 
 	CachedBackground _bubblesBackground;
 	QImage _bubblesBackgroundPrepared;
+	uint64 _bubblesBackgroundPreparedHash = 0;
 	CacheBackgroundRequest _bubblesCachingRequest;
 	QSize _cacheBubblesArea;
 	crl::time _lastBubblesAreaChangeTime = 0;
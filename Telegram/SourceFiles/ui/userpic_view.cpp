@@ -11,7 +11,113 @@ https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 #include "ui/painter.h"
 #include "ui/image/image_prepare.h"
 
+#include <QtCore/QMutex>
+
 namespace Ui {
+namespace {
+
+constexpr auto kSharedUserpicsSizeLimit = 24 * 1024 * 1024;
+
+struct SharedUserpicKey {
+	qint64 cloud = 0;
+	int size = 0;
+	int ratio = 0;
+	uint32 shape = 0;
+
+	friend inline auto operator<=>(
+		const SharedUserpicKey &,
+		const SharedUserpicKey &) = default;
+};
+
+struct SharedUserpic {
+	QImage image;
+	uint64 usedAt = 0;
+};
+
+// Rounded userpics are shared by all views of the same cloud image, so
+// every list showing a peer at the same size reuses one prepared image.
+class SharedUserpics final {
+public:
+	[[nodiscard]] QImage find(const SharedUserpicKey &key) {
+		auto lock = QMutexLocker(&_mutex);
+		const auto i = _entries.find(key);
+		if (i == end(_entries)) {
+			return QImage();
+		}
+		i->second.usedAt = ++_counter;
+		return i->second.image;
+	}
+	void remember(const SharedUserpicKey &key, const QImage &image) {
+		auto lock = QMutexLocker(&_mutex);
+		const auto i = _entries.find(key);
+		if (i != end(_entries)) {
+			return;
+		}
+		_entries.emplace(key, SharedUserpic{ image, ++_counter });
+		_size += image.sizeInBytes();
+		if (_size > kSharedUserpicsSizeLimit) {
+			evictOldest();
+		}
+	}
+
+private:
+	void evictOldest() {
+		// Drop the least recently used quarter at once,
+		// so that the eviction cost is amortized between insertions.
+		auto used = std::vector<uint64>();
+		used.reserve(_entries.size());
+		for (const auto &[key, entry] : _entries) {
+			used.push_back(entry.usedAt);
+		}
+		const auto middle = begin(used) + (used.size() / 4);
+		ranges::nth_element(used, middle);
+		const auto threshold = *middle;
+		// Compact in one pass, erasing one by one shifts the rest each time.
+		// The kept entries go in the key order, so each emplace appends.
+		auto kept = base::flat_map<SharedUserpicKey, SharedUserpic>();
+		for (auto &[key, entry] : _entries) {
+			if (entry.usedAt <= threshold) {
+				_size -= entry.image.sizeInBytes();
+			} else {
+				kept.emplace(key, std::move(entry));
+			}
+		}
+		_entries = std::move(kept);
+	}
+
+	QMutex _mutex;
+	base::flat_map<SharedUserpicKey, SharedUserpic> _entries;
+	int64 _size = 0;
+	uint64 _counter = 0;
+
+};
+
+[[nodiscard]] SharedUserpics &CachedUserpics() {
+	static auto result = SharedUserpics();
+	return result;
+}
+
+[[nodiscard]] QImage PrepareCloudUserpic(
+		const QImage &cloud,
+		int size,
+		PeerUserpicShape shape) {
+	auto result = cloud.scaled(
+		QSize(size, size),
+		Qt::IgnoreAspectRatio,
+		Qt::SmoothTransformation);
+	if (shape == PeerUserpicShape::Monoforum) {
+		return Ui::ApplyMonoforumShape(std::move(result));
+	} else if (shape == PeerUserpicShape::Forum) {
+		return Images::Round(
+			std::move(result),
+			Images::CornersMask(size
+				* Ui::ForumUserpicRadiusMultiplier()
+				/ style::DevicePixelRatio()));
+	}
+	return Images::Circle(std::move(result));
+}
+
+} // namespace
 
 float64 ForumUserpicRadiusMultiplier() {
 	return 0.3;
@@ -45,20 +151,17 @@ void ValidateUserpicCache(
 	view.paletteVersion = version;
 
 	if (cloud) {
-		view.cached = cloud->scaled(
-			full,
-			Qt::IgnoreAspectRatio,
-			Qt::SmoothTransformation);
-		if (shape == PeerUserpicShape::Monoforum) {
-			view.cached = Ui::ApplyMonoforumShape(std::move(view.cached));
-		} else if (shape == PeerUserpicShape::Forum) {
-			view.cached = Images::Round(
-				std::move(view.cached),
-				Images::CornersMask(size
-					* Ui::ForumUserpicRadiusMultiplier()
-					/ style::DevicePixelRatio()));
-		} else {
-			view.cached = Images::Circle(std::move(view.cached));
+		const auto key = SharedUserpicKey{
+			.cloud = cloud->cacheKey(),
+			.size = size,
+			.ratio = style::DevicePixelRatio(),
+			.shape = shapeValue,
+		};
+		auto &cache = CachedUserpics();
+		view.cached = cache.find(key);
+		if (view.cached.isNull()) {
+			view.cached = PrepareCloudUserpic(*cloud, size, shape);
+			cache.remember(key, view.cached);
 		}
 	} else {
 		if (view.cached.size() != full) {
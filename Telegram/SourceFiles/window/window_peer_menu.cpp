@@ -205,6 +205,12 @@ void MarkAsReadChatList(not_null<Dialogs::MainList*> list) {
 			mark.push_back(history);
 		}
 	}
+	if (mark.empty()) {
+		return;
+	}
+	const auto main = mark.front()->owner().chatsList();
+	const auto holdMain = main->holdUnreadStateChanges();
+	const auto holdList = list->holdUnreadStateChanges();
 	ranges::for_each(mark, MarkAsReadThread);
 }
 
@@ -19,6 +19,8 @@ PRIVATE
     iv/iv_pch.h
     iv/iv_prepare.cpp
     iv/iv_prepare.h
+    iv/iv_prepare_html.cpp
+    iv/iv_prepare_html.h
 )
 
 nice_target_sources(td_iv ${res_loc}
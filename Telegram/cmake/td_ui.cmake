@@ -268,6 +268,8 @@ PRIVATE
     statistics/view/abstract_chart_view.h
     statistics/view/bar_chart_view.cpp
     statistics/view/bar_chart_view.h
+    statistics/view/chart_line_decimator.cpp
+    statistics/view/chart_line_decimator.h
     statistics/view/chart_rulers_view.cpp
     statistics/view/chart_rulers_view.h
     statistics/view/chart_view_factory.cpp
@@ -560,4 +562,5 @@ PRIVATE
     desktop-app::lib_stripe
     desktop-app::external_kcoreaddons
     desktop-app::external_webrtc
+    desktop-app::external_xxhash
 )
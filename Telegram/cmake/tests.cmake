@@ -4,41 +4,73 @@
 # For license and copyright information please follow this link:
 # https://github.com/telegramdesktop/tdesktop/blob/master/LEGAL
 
-add_executable(test_text WIN32)
-init_target(test_text "(tests)")
+function(add_test_app name)
+    set(target test_${name})
 
-target_include_directories(test_text PRIVATE ${src_loc})
+    add_executable(${target} WIN32)
+    init_target(${target} "(tests)")
 
-nice_target_sources(test_text ${src_loc}
+    target_include_directories(${target} PRIVATE ${src_loc})
+
+    nice_target_sources(${target} ${src_loc}
+    PRIVATE
+        tests/test_main.cpp
+        tests/test_main.h
+        tests/test_${name}.cpp
+    )
+
+    nice_target_sources(${target} ${res_loc}
+    PRIVATE
+        qrc/emoji_1.qrc
+        qrc/emoji_2.qrc
+        qrc/emoji_3.qrc
+        qrc/emoji_4.qrc
+        qrc/emoji_5.qrc
+        qrc/emoji_6.qrc
+        qrc/emoji_7.qrc
+        qrc/emoji_8.qrc
+    )
+
+    target_link_libraries(${target}
+    PRIVATE
+        desktop-app::lib_base
+        desktop-app::lib_crl
+        desktop-app::lib_ui
+        desktop-app::external_qt
+        desktop-app::external_qt_static_plugins
+    )
+
+    set_target_properties(${target} PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR})
+
+    add_dependencies(Telegram ${target})
+
+    target_prepare_qrc(${target})
+endfunction()
+
+add_test_app(text)
+
+# The tested sources are compiled in directly, because td_export needs
+# symbols that live only in the Telegram target, like core/utils.cpp.
+add_test_app(export_html)
+nice_target_sources(test_export_html ${src_loc}
 PRIVATE
-    tests/test_main.cpp
-    tests/test_main.h
-    tests/test_text.cpp
+    export/output/export_output_html_serialize.cpp
+    export/output/export_output_html_serialize.h
 )
 
-nice_target_sources(test_text ${res_loc}
+# td_ui needs symbols from the Telegram target, like AyuSettings.
+add_test_app(chart_decimation)
+nice_target_sources(test_chart_decimation ${src_loc}
 PRIVATE
-    qrc/emoji_1.qrc
-    qrc/emoji_2.qrc
-    qrc/emoji_3.qrc
-    qrc/emoji_4.qrc
-    qrc/emoji_5.qrc
-    qrc/emoji_6.qrc
-    qrc/emoji_7.qrc
-    qrc/emoji_8.qrc
+    statistics/view/chart_line_decimator.cpp
+    statistics/view/chart_line_decimator.h
 )
 
-target_link_libraries(test_text
+# td_iv needs Lang::details::Current() from lang_instance.cpp and the
+# chat styles from td_ui, both linked only into the Telegram target.
+add_test_app(iv_html)
+nice_target_sources(test_iv_html ${src_loc}
 PRIVATE
-    desktop-app::lib_base
-    desktop-app::lib_crl
-    desktop-app::lib_ui
-    desktop-app::external_qt
-    desktop-app::external_qt_static_plugins
+    iv/iv_prepare_html.cpp
+    iv/iv_prepare_html.h
 )
-
-set_target_properties(test_text PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR})
-
-add_dependencies(Telegram test_text)
-
-target_prepare_qrc(test_text)